@@ -0,0 +1,30 @@
+/**	@file arg_span.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines a view of the arguments passed to a function call
+*/
+
+#pragma once
+#include "value.hpp"
+#include <cstddef>
+
+// The arguments of one call, left where the caller evaluated them. A callee must copy what it
+// keeps before running any further code, since that code may push more arguments and move them.
+class ArgSpan
+{
+private:
+	Value const * data_;
+	std::size_t size_;
+
+public:
+	ArgSpan(Value const * data, std::size_t size) : data_(data), size_(size) {}
+
+	std::size_t size() const { return size_; }
+	Value const * begin() const { return data_; }
+	Value const * end() const { return data_ + size_; }
+	Value const& operator[](std::size_t i) const { return data_[i]; }
+	Value const& front() const { return data_[0]; }
+	Value const& back() const { return data_[size_ - 1]; }
+};
@@ -0,0 +1,43 @@
+/**	@file ast_arena.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of AstArena
+*/
+
+#include "ast_arena.hpp"
+
+AstArena::~AstArena()
+{
+	// later nodes may refer to earlier ones, so they are destroyed first
+	for (auto itDestructor = destructors_.rbegin(); itDestructor != destructors_.rend(); ++itDestructor)
+		itDestructor->destroy_(itDestructor->obj_);
+}
+
+/**
+@name:		allocate
+@purpose:	returns aligned memory from the current block, starting a new block when it is full
+@param:		std::size_t, std::size_t
+@return:	void *
+*/
+void * AstArena::allocate(std::size_t size, std::size_t align)
+{
+	std::size_t space = end_ - next_;
+	void * ptr = next_;
+
+	if (next_ == nullptr || std::align(align, size, ptr, space) == nullptr)
+	{
+		std::size_t blockSize = size + align > BLOCK_SIZE ? size + align : BLOCK_SIZE;
+		blocks_.emplace_back(new char[blockSize]);
+		next_ = blocks_.back().get();
+		end_ = next_ + blockSize;
+
+		space = blockSize;
+		ptr = next_;
+		std::align(align, size, ptr, space);
+	}
+
+	next_ = static_cast<char *>(ptr) + size;
+	return ptr;
+}
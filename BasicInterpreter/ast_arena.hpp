@@ -0,0 +1,66 @@
+/**	@file ast_arena.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the arena that holds every token and node of one program
+*/
+
+#pragma once
+#include "ref.hpp"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Nodes are placed one after another in large blocks and all freed together when the arena is
+// destroyed. The handles handed out never delete them, so the arena must outlive the program.
+class AstArena
+{
+private:
+	static std::size_t const BLOCK_SIZE = 64 * 1024;
+
+	struct Destructor
+	{
+		void (*destroy_)(void *);
+		void * obj_;
+	};
+
+	std::vector<std::unique_ptr<char[]>> blocks_;
+	char * next_;
+	char * end_;
+	std::vector<Destructor> destructors_;
+
+public:
+	AstArena() : next_(nullptr), end_(nullptr) {}
+	AstArena(AstArena const&) = delete;
+	AstArena& operator=(AstArena const&) = delete;
+	~AstArena();
+
+	template <typename T, typename... Args>
+	Ref<T> make(Args&&... args);
+
+private:
+	void * allocate(std::size_t size, std::size_t align);
+};
+
+/**
+@name:		make
+@purpose:	constructs an object in the arena and returns a handle that does not own it
+@param:		Args&&...
+@return:	Ref<T>
+*/
+template <typename T, typename... Args>
+Ref<T> AstArena::make(Args&&... args)
+{
+	T * obj = ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+	if (!std::is_trivially_destructible<T>::value)
+		destructors_.push_back(Destructor{ [](void * ptr) { static_cast<T *>(ptr)->~T(); }, obj });
+
+	// the arena frees the node, so no handle may
+	obj->makeImmortal();
+	return Ref<T>(obj);
+}
@@ -7,8 +7,8 @@
 */
 
 #pragma once
-#include <list>
 #include "interpreter.hpp"
+#include "arg_span.hpp"
 #include "integer.hpp"
 #include "float.hpp"
 #include "boolean.hpp"
@@ -26,5 +26,5 @@ public:
 	DEF_IS_CONVERTIBLE_FROM(BetaCallable)
 
 	virtual unsigned short arity() = 0;
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) = 0;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) = 0;
 };
\ No newline at end of file
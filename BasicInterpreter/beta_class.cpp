@@ -8,23 +8,88 @@
 
 #include "beta_class.hpp"
 #include "beta_instance.hpp"
+using namespace std;
+
+/**
+@name:		nextId
+@purpose:	returns a number no other class has been given
+@param:		null
+@return:	std::uint64_t
+*/
+static uint64_t nextId()
+{
+	static uint64_t id = 0;
+	return ++id;
+}
+
+BetaClass::BetaClass(std::string name, BetaClass::pointer_type super, std::list<Variable::pointer_type> data, std::map<std::string, CustomFunction::pointer_type> methods) 
+	: name_(name), super_(super), id_(nextId()), methods_(methods)
+{
+	kind_ = first_kind;
+
+	// inherited fields keep their parent's offsets, and redeclaring one reuses its slot
+	if (super_ != nullptr)
+		layout_ = super_->layout_;
+
+	for (auto const& datum : data)
+		layout_.insert(pair<string, unsigned>(datum->getName(), static_cast<unsigned>(layout_.size())));
+
+	// only the class's own init is used to construct it
+	auto itInit = methods_.find("init");
+	if (itInit != methods_.end())
+		init_ = itInit->second;
+
+	// the parent's table is already flattened, so one pass brings in every inherited method; insert keeps overrides
+	if (super_ != nullptr)
+		methods_.insert(super_->methods_.begin(), super_->methods_.end());
+}
 
 /**
 @name:		findMethod
-@purpose:	finds a class's method, either within itself or in its parent
-@param:		std::shared_ptr<BetaInstance>, std::string
+@purpose:	finds a class's method, either within itself or in its parent, and binds it to an instance
+@param:		BetaInstance::pointer_type, std::string const&
 @return:	CustomFunction::pointer_type
 */
-CustomFunction::pointer_type BetaClass::findMethod(std::shared_ptr<BetaInstance> instance, std::string name)
+CustomFunction::pointer_type BetaClass::findMethod(BetaInstance::pointer_type instance, std::string const& name)
 {
 	// when a method is found, bind the instance to it so that variables are available
-	if (methods_.count(name) == 1)
-		return methods_.find(name)->second->bind(instance);
+	CustomFunction::pointer_type const& method = lookupMethod(name);
+	if (method == nullptr)
+		return nullptr;
 
-	if (super_ != nullptr)
-		return super_->findMethod(instance, name);
+	return method->bind(instance);
+}
+
+/**
+@name:		lookupMethod
+@purpose:	finds a class's method, either within itself or in its parent, without binding it
+@param:		std::string const&
+@return:	CustomFunction::pointer_type const&
+*/
+CustomFunction::pointer_type const& BetaClass::lookupMethod(std::string const& name) const
+{
+	static CustomFunction::pointer_type const none;
+
+	auto itMethod = methods_.find(name);
+	if (itMethod == methods_.end())
+		return none;
+
+	return itMethod->second;
+}
+
+/**
+@name:		fieldOffset
+@purpose:	returns the index of a field within an instance, or -1 if the class has no such field
+@param:		std::string const&
+@return:	int
+*/
+int BetaClass::fieldOffset(std::string const& name) const
+{
+	auto itField = layout_.find(name);
+	if (itField == layout_.end())
+		return -1;
 
-	return nullptr;
+	return static_cast<int>(itField->second);
 }
 
 /**
@@ -35,11 +100,8 @@ CustomFunction::pointer_type BetaClass::findMethod(std::shared_ptr<BetaInstance>
 */
 unsigned short BetaClass::arity()
 {
-	CustomFunction::pointer_type init = nullptr;
-	
 	// since this is a class, we check for an initializer
-	if (methods_.count("init") == 1)
-		init = methods_.find("init")->second;
+	CustomFunction::pointer_type init = initializer();
 	
 	if (init == nullptr) return 0;
 	return init->arity();
@@ -48,20 +110,65 @@ unsigned short BetaClass::arity()
 /**
 @name:		call
 @purpose:	Calls the init method and then returns a new instance of the class
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type BetaClass::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value BetaClass::call(Interpreter * interpreter, ArgSpan args)
 {
-	auto instance = BetaInstance::pointer_type(new BetaInstance(this, data_));
-	
-	CustomFunction::pointer_type init = nullptr;
-
-	if (methods_.count("init") == 1)
-		init = methods_.find("init")->second;
+	auto instance = instantiate();
+	CustomFunction::pointer_type init = initializer();
 
 	if (init != nullptr)
-		init->bind(instance)->call(interpreter, args);
+		init->invoke(interpreter, Value(instance), args);
+
+	return Value(instance);
+}
+
+/**
+@name:		initializer
+@purpose:	Returns the class's own init method, or null if it has none
+@param:		null
+@return:	CustomFunction::pointer_type
+*/
+CustomFunction::pointer_type BetaClass::initializer()
+{
+	return init_;
+}
 
-	return instance;
+/**
+@name:		instantiate
+@purpose:	Returns a new instance of the class with every field null, without calling init
+@param:		null
+@return:	BetaInstance::pointer_type
+*/
+BetaInstance::pointer_type BetaClass::instantiate()
+{
+	// the instance owns its class, so a class left in an unreachable cycle is not freed under it
+	return Heap::get().make<BetaInstance>(BetaClass::pointer_type(this));
+}
+/**
+@name:		trace
+@purpose:	reports the superclass and every method to the collector
+@param:		Tracer &
+@return:	void
+*/
+void BetaClass::trace(Tracer & tracer) const
+{
+	tracer.visit(super_.get());
+	for (auto const& method : methods_)
+		tracer.visit(method.second.get());
+	tracer.visit(init_.get());
+}
+
+/**
+@name:		clearReferences
+@purpose:	drops the superclass and methods of a class the collector found unreachable
+@param:		null
+@return:	void
+*/
+void BetaClass::clearReferences()
+{
+	super_.reset();
+	methods_.clear();
+	init_.reset();
 }
@@ -7,6 +7,7 @@
 */
 
 #pragma once
+#include <cstdint>
 #include <list>
 #include <map>
 #include <string>
@@ -16,7 +17,7 @@
 
 class BetaInstance;
 
-class BetaClass : public BetaCallable
+class BetaClass : public BetaCallable, public Collectable
 {
 public:
 	DEF_POINTER_TYPE(BetaClass)
@@ -24,15 +25,25 @@ public:
 
 	std::string name_;
 	BetaClass::pointer_type super_;
+	std::uint64_t const id_;		// never reused, unlike the class's address, so caches can key on it
 private:
-	std::list<Variable::pointer_type> data_;
-	std::map<std::string, CustomFunction::pointer_type> methods_;
+	std::map<std::string, unsigned> layout_;						// offset of each field, inherited ones included
+	std::map<std::string, CustomFunction::pointer_type> methods_;	// own and inherited methods, flattened once
+	CustomFunction::pointer_type init_;
 public:
-	BetaClass(std::string name, BetaClass::pointer_type super, std::list<Variable::pointer_type> data, std::map<std::string, CustomFunction::pointer_type> methods) : name_(name), super_(super), data_(data), methods_(methods) {}
+	BetaClass(std::string name, BetaClass::pointer_type super, std::list<Variable::pointer_type> data, std::map<std::string, CustomFunction::pointer_type> methods);
 
 	virtual string_type toString() const { return name_; }
-	CustomFunction::pointer_type findMethod(std::shared_ptr<BetaInstance> instance, std::string name);
+	CustomFunction::pointer_type findMethod(Ref<BetaInstance> instance, std::string const& name);
+	CustomFunction::pointer_type const& lookupMethod(std::string const& name) const;
+	int fieldOffset(std::string const& name) const;
+	unsigned fieldCount() const { return static_cast<unsigned>(layout_.size()); }
+	CustomFunction::pointer_type initializer();
+	Ref<BetaInstance> instantiate();
 
 	virtual unsigned short arity() override;
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
+
+	virtual void trace(Tracer & tracer) const override;
+	virtual void clearReferences() override;
 };
\ No newline at end of file
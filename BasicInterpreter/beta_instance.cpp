@@ -9,28 +9,25 @@
 #include "beta_instance.hpp"
 using namespace std;
 
-BetaInstance::BetaInstance(BetaClass * clas, std::list<Variable::pointer_type> data)
+BetaInstance::BetaInstance(BetaClass::pointer_type clas) : clas_(clas), fields_(clas->fieldCount())
 {
-	clas_ = clas;
-
-	// add class variables to the instance
-	for (auto datum : data)
-		fields_.insert(pair<string, Token::pointer_type>(datum->getName(), nullptr));
+	kind_ = first_kind;
 }
 
 /**
 @name:		get
 @purpose:	returns a pointer to a field, if it exists
 @param:		std::string
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type BetaInstance::get(std::string name)
+Value BetaInstance::get(std::string name)
 {
-	if (fields_.count(name) == 1)
-		return fields_.find(name)->second;
+	int offset = clas_->fieldOffset(name);
+	if (offset >= 0)
+		return fields_[offset];
 
-	CustomFunction::pointer_type method = clas_->findMethod(shared_from_this(), name);
-	if (method != nullptr) return method;
+	CustomFunction::pointer_type method = clas_->findMethod(BetaInstance::pointer_type(this), name);
+	if (method != nullptr) return Value(method);
 
 	stringstream ss;
 	ss << "BetaInstanceException: Undefined property: '" << name << "'.";
@@ -40,13 +37,39 @@ Token::pointer_type BetaInstance::get(std::string name)
 /**
 @name:		set
 @purpose:	sets a fields value, or adds it if it doesn't exist
-@param:		std::string
-@return:	Token::pointer_type
+@param:		std::string, Value
+@return:	void
 */
-void BetaInstance::set(std::string name, Token::pointer_type val)
+void BetaInstance::set(std::string name, Value val)
 {
-	if (fields_.count(name) == 1)
-		fields_.at(name) = val;
+	int offset = clas_->fieldOffset(name);
+	if (offset >= 0)
+		setField(offset, std::move(val));
 	else
 		throw exception(string("Field \"" + name + "\" does not exist in class \"" + clas_->name_ + "\"").c_str());
 }
+
+/**
+@name:		trace
+@purpose:	reports the instance's class and fields to the collector
+@param:		Tracer &
+@return:	void
+*/
+void BetaInstance::trace(Tracer & tracer) const
+{
+	tracer.visit(clas_.get());
+	for (auto const& val : fields_)
+		tracer.visit(val);
+}
+
+/**
+@name:		clearReferences
+@purpose:	drops the fields of an instance the collector found unreachable
+@param:		null
+@return:	void
+*/
+void BetaInstance::clearReferences()
+{
+	fields_.clear();
+	clas_.reset();
+}
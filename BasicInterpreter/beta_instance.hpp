@@ -7,24 +7,30 @@
 */
 
 #pragma once
-#include <map>
 #include <string>
+#include <vector>
 #include "beta_class.hpp"
 
-class BetaInstance : public Token, public std::enable_shared_from_this<BetaInstance>
+class BetaInstance : public Token, public Collectable
 {
 public:
 	DEF_POINTER_TYPE(BetaInstance)
 	DEF_IS_CONVERTIBLE_FROM(BetaInstance)
 
 private:
-	BetaClass * clas_;
-	std::map<std::string, Token::pointer_type> fields_;
+	BetaClass::pointer_type clas_;
+	std::vector<Value> fields_;		// laid out by the class, see BetaClass::fieldOffset
 
 public:	
-	BetaInstance(BetaClass * clas, std::list<Variable::pointer_type> data);
+	BetaInstance(BetaClass::pointer_type clas);
 
-	Token::pointer_type get(std::string name);
-	void set(std::string name, Token::pointer_type val);
+	Value get(std::string name);
+	void set(std::string name, Value val);
+	BetaClass const& getClass() const { return *clas_; }
+	Value const& getField(unsigned offset) const { return fields_[offset]; }
+	void setField(unsigned offset, Value val) { val.promote(); fields_[offset] = std::move(val); }
 	virtual string_type toString() const { return clas_->name_ + " instance"; }
+
+	virtual void trace(Tracer & tracer) const override;
+	virtual void clearReferences() override;
 };
\ No newline at end of file
@@ -13,11 +13,12 @@ class Boolean : public Operand
 {
 public:
 	DEF_POINTER_TYPE(Boolean)
+	DEF_IS_CONVERTIBLE_FROM(Boolean)
 	using value_type = bool;
 private:
 	value_type value_;
 public:
-	Boolean(value_type value = false) : value_(value) {}
+	Boolean(value_type value = false) : value_(value) { kind_ = first_kind; }
 	value_type getValue() const { return value_; }
 	string_type toString() const override;
 };
@@ -25,13 +26,13 @@ public:
 class True : public Boolean
 {
 public:
-	True() : Boolean(true) {}
+	True() : Boolean(true) { kind_ = first_kind; }
 	DEF_IS_CONVERTIBLE_FROM(True)
 };
 
 class False : public Boolean
 {
 public:
-	False() : Boolean(false) {}
+	False() : Boolean(false) { kind_ = first_kind; }
 	DEF_IS_CONVERTIBLE_FROM(False)
 };
\ No newline at end of file
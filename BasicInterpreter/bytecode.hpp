@@ -0,0 +1,102 @@
+/**	@file bytecode.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the instruction set and the compiled form of a program run by the VM
+*/
+
+#pragma once
+#include "statement.hpp"
+#include "value.hpp"
+#include "inline_cache.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Every operand follows its opcode as a 16-bit little-endian integer. Jump offsets are counted
+// from the end of the jump instruction, forwards for JUMP* and backwards for LOOP*.
+enum class OpCode : std::uint8_t
+{
+	CONSTANT,		// index			pushes a constant
+	NIL,			//					pushes null
+	POP,			//					discards the top of the stack
+	GET_LOCAL,		// depth, slot		pushes a variable from an enclosing environment
+	SET_LOCAL,		// depth, slot		assigns the top of the stack to a variable, leaving it in place
+	GET_GLOBAL,		// slot				pushes a global variable
+	SET_GLOBAL,		// slot				assigns the top of the stack to a global, leaving it in place
+	DEFINE,			// slot				pops a value into a slot of the current environment
+	CHECK_TYPE,		// VarType			throws if the top of the stack cannot be assigned to the type
+	BEGIN_SCOPE,	// slots			enters a new environment for a block
+	END_SCOPE,		//					returns to the block's enclosing environment
+	BEGIN_FRAME,	// slots			enters a pooled environment for a block that no closure captures
+	END_FRAME,		//					returns a block's pooled environment and goes back to the enclosing one
+	GET_PROPERTY,	// name, cache		replaces an instance with one of its fields or bound methods
+	CHECK_INSTANCE,	//					throws if the top of the stack is not an instance
+	SET_PROPERTY,	// name, cache		pops a value and an instance, sets the field and pushes the value
+	GET_SUPER,		// depth, name		pushes a superclass method bound to "me"
+	GET_METHOD,		// name, cache		replaces an instance with an unbound method and the instance, or a field and null
+
+	POWER, ADD, SUBTRACT, MULTIPLY, DIVIDE, MODULUS,
+	AND, NAND, OR, NOR, XOR, XNOR,
+	EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL,
+	FACTORIAL, IDENTITY, NEGATE, NOT,
+
+	JUMP,			// offset
+	JUMP_IF_FALSE,	// Condition, offset	pops a condition, which must be a boolean
+	LOOP,			// offset
+	LOOP_IF_TRUE,	// Condition, offset	pops a condition, which must be a boolean
+	AND_THEN,		// offset			keeps a false left operand and jumps, otherwise pops it
+	OR_ELSE,		// offset			keeps a true left operand and jumps, otherwise pops it
+
+	// superinstructions, written by fuseSuperinstructions in place of the sequences they stand for
+	JUMP_UNLESS_LOCAL_CONST,	// comparison, Condition, depth, slot, index, offset	GET_LOCAL, CONSTANT, the comparison and JUMP_IF_FALSE
+	JUMP_UNLESS_GLOBAL_CONST,	// comparison, Condition, slot, index, offset		GET_GLOBAL, CONSTANT, the comparison and JUMP_IF_FALSE
+	ADD_LOCAL_CONST,			// depth, slot, index						GET_LOCAL, CONSTANT, ADD, SET_LOCAL to the same variable and POP
+	ADD_GLOBAL_CONST,			// slot, index								GET_GLOBAL, CONSTANT, ADD, SET_GLOBAL to the same variable and POP
+	ADD_LOCAL_CONST_CHECKED,	// depth, slot, index, VarType				ADD_LOCAL_CONST with a CHECK_TYPE before the SET_LOCAL
+	ADD_GLOBAL_CONST_CHECKED,	// slot, index, VarType						ADD_GLOBAL_CONST with a CHECK_TYPE before the SET_GLOBAL
+
+	CHECK_CALLABLE,	//					throws if the top of the stack cannot be called
+	CALL,			// count			calls the value below its arguments
+	INVOKE,			// count			calls the method below its receiver and arguments, passing the receiver as "me"
+	CLOSURE,		// function			pushes a function closed over the current environment
+	INHERIT,		//					pops a superclass into a new environment holding "super"
+	CLASS,			// class			pushes a class whose methods close over the current environment
+	RETURN,			//					returns the top of the stack from a function
+	LEAVE,			//					returns from a function that reached the end of its body
+	PRINT,			//					pops and prints a value
+	NEXT_STATEMENT,	//					advances the position tracker past a top-level statement
+	HALT
+};
+
+// which statement a conditional jump belongs to, so a non-boolean condition is reported the same way
+enum class Condition : std::uint16_t { IF, WHILE, DO_WHILE };
+
+struct Chunk
+{
+	std::vector<std::uint8_t> code_;
+	std::vector<Value> constants_;
+	std::vector<std::string> names_;
+	mutable std::vector<PropertyCache> caches_;		// filled in as the program runs
+};
+
+struct FunctionProto
+{
+	StmtFunc * declaration_;			// owned by the program's AstArena
+	Chunk chunk_;
+};
+
+struct ClassProto
+{
+	StmtClass * declaration_;
+	std::vector<unsigned> methods_;		// index into Program::functions_ of each method, in declaration order
+};
+
+struct Program
+{
+	Chunk script_;
+	std::vector<std::unique_ptr<FunctionProto>> functions_;
+	std::vector<ClassProto> classes_;
+};
@@ -0,0 +1,90 @@
+/**	@file checked_math.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif overflow-checked 64-bit integer arithmetic used by the small-integer fast paths
+*/
+
+#pragma once
+#include <cstdint>
+#include <limits>
+
+// each function stores the result in res and returns true if the operation overflowed
+
+#if defined(__GNUC__) || defined(__clang__)
+
+inline bool checkedAdd(std::int64_t a, std::int64_t b, std::int64_t& res) { return __builtin_add_overflow(a, b, &res); }
+inline bool checkedSub(std::int64_t a, std::int64_t b, std::int64_t& res) { return __builtin_sub_overflow(a, b, &res); }
+inline bool checkedMul(std::int64_t a, std::int64_t b, std::int64_t& res) { return __builtin_mul_overflow(a, b, &res); }
+
+#else
+
+inline bool checkedAdd(std::int64_t a, std::int64_t b, std::int64_t& res)
+{
+	if ((b > 0 && a > (std::numeric_limits<std::int64_t>::max)() - b) ||
+		(b < 0 && a < (std::numeric_limits<std::int64_t>::min)() - b))
+		return true;
+
+	res = a + b;
+	return false;
+}
+
+inline bool checkedSub(std::int64_t a, std::int64_t b, std::int64_t& res)
+{
+	if ((b < 0 && a > (std::numeric_limits<std::int64_t>::max)() + b) ||
+		(b > 0 && a < (std::numeric_limits<std::int64_t>::min)() + b))
+		return true;
+
+	res = a - b;
+	return false;
+}
+
+inline bool checkedMul(std::int64_t a, std::int64_t b, std::int64_t& res)
+{
+	if (a == 0 || b == 0)
+	{
+		res = 0;
+		return false;
+	}
+
+	// the only product that cannot be checked by division
+	if ((a == -1 && b == (std::numeric_limits<std::int64_t>::min)()) ||
+		(b == -1 && a == (std::numeric_limits<std::int64_t>::min)()))
+		return true;
+
+	std::int64_t prod = static_cast<std::int64_t>(static_cast<std::uint64_t>(a) * static_cast<std::uint64_t>(b));
+	if (prod / b != a)
+		return true;
+
+	res = prod;
+	return false;
+}
+
+#endif
+
+/**
+@name:		checkedPow
+@purpose:	raises a 64-bit integer to a non-negative 64-bit power by squaring
+@param:		std::int64_t, std::int64_t, std::int64_t&
+@return:	bool - true if the result does not fit in 64 bits
+*/
+inline bool checkedPow(std::int64_t base, std::int64_t exp, std::int64_t& res)
+{
+	std::int64_t acc = 1;
+	while (exp > 0)
+	{
+		if (exp & 1)
+		{
+			if (checkedMul(acc, base, acc))
+				return true;
+		}
+
+		exp >>= 1;
+		if (exp > 0 && checkedMul(base, base, base))
+			return true;
+	}
+
+	res = acc;
+	return false;
+}
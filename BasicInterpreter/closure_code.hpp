@@ -0,0 +1,46 @@
+/**	@file closure_code.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the compiled form of a program run by the closure engine, a tree of nodes that each run themselves
+*/
+
+#pragma once
+#include "statement.hpp"
+#include "interpreter.hpp"
+#include <memory>
+#include <vector>
+
+class ClosureEngine;
+
+// A node has its resolved slots, operator and children fixed when it is compiled, so running
+// one is a single virtual call with none of the visitor's double dispatch or type tests.
+class ExprCode
+{
+public:
+	virtual ~ExprCode() {}
+	virtual Value run(ClosureEngine & engine) = 0;
+};
+
+class StmtCode
+{
+public:
+	virtual ~StmtCode() {}
+	virtual Completion run(ClosureEngine & engine) = 0;
+};
+
+using ExprCodeList = std::vector<std::unique_ptr<ExprCode>>;
+using StmtCodeList = std::vector<std::unique_ptr<StmtCode>>;
+
+struct FunctionCode
+{
+	StmtFunc * declaration_;			// owned by the program's AstArena
+	StmtCodeList body_;
+};
+
+struct ClosureProgram
+{
+	StmtCodeList script_;
+	std::vector<std::unique_ptr<FunctionCode>> functions_;	// every function and method, referred to by the nodes that create them
+};
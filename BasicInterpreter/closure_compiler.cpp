@@ -0,0 +1,949 @@
+/**	@file closure_compiler.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of ClosureCompiler class and of the nodes it builds
+*/
+
+#include "closure_compiler.hpp"
+#include "closure_engine.hpp"
+#include "fast_path.hpp"
+#include "inline_cache.hpp"
+#include "beta_class.hpp"
+#include "beta_instance.hpp"
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+using namespace std;
+
+// where a variable lives, decided by the resolver
+enum class Reach { GLOBAL, LOCAL, ENCLOSING };
+
+// where a block keeps its declarations, decided by the resolver
+enum class BlockScope { SHARED, HEAP, POOLED };
+
+class LiteralCode : public ExprCode
+{
+	Value value_;
+public:
+	LiteralCode(Value value) : value_(std::move(value)) {}
+	virtual Value run(ClosureEngine &) override { return value_; }
+};
+
+template <Reach R>
+class VariableCode : public ExprCode
+{
+	unsigned depth_;
+	unsigned slot_;
+public:
+	VariableCode(unsigned depth, unsigned slot) : depth_(depth), slot_(slot) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		if constexpr (R == Reach::GLOBAL)
+			return engine.globals().get(slot_);
+		else if constexpr (R == Reach::LOCAL)
+			return engine.env()->get(slot_);
+		else
+			return engine.env()->getAt(depth_, slot_);
+	}
+};
+
+template <Reach R, bool Checked>
+class AssignCode : public ExprCode
+{
+	std::unique_ptr<ExprCode> expr_;
+	VarType type_;
+	unsigned depth_;
+	unsigned slot_;
+public:
+	AssignCode(std::unique_ptr<ExprCode> expr, VarType type, unsigned depth, unsigned slot) : expr_(std::move(expr)), type_(type), depth_(depth), slot_(slot) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		Value val = expr_->run(engine);
+
+		if constexpr (!Checked)
+			if (!Interpreter::checkType(type_, val))
+				throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + val.toString() + "\" to a " + Interpreter::VarTypeName(type_)).c_str());
+
+		if constexpr (R == Reach::GLOBAL)
+			engine.globals().define(slot_, val);
+		else
+			engine.env()->reassignAt(depth_, slot_, val);
+
+		return val;
+	}
+};
+
+// an operator whose fast paths are fixed when it is compiled, GENERIC where it has none
+template <BinaryPath IntPath, BinaryPath FloatPath>
+class BinaryCode : public ExprCode
+{
+	std::unique_ptr<ExprCode> left_;
+	BinaryOperator * oper_;			// owned by the program's AstArena
+	std::unique_ptr<ExprCode> right_;
+public:
+	BinaryCode(std::unique_ptr<ExprCode> left, BinaryOperator * oper, std::unique_ptr<ExprCode> right) : left_(std::move(left)), oper_(oper), right_(std::move(right)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		Value left = left_->run(engine);
+		Value right = right_->run(engine);
+
+		if constexpr (IntPath != BinaryPath::GENERIC)
+		{
+			Value result = runBinaryPath(IntPath, left, right);
+			if (!result.isNil())
+				return result;
+		}
+
+		if constexpr (FloatPath != BinaryPath::GENERIC)
+		{
+			Value result = runBinaryPath(FloatPath, left, right);
+			if (!result.isNil())
+				return result;
+		}
+
+		return oper_->perform(left, right);
+	}
+};
+
+template <UnaryPath Path>
+class UnaryCode : public ExprCode
+{
+	UnaryOperator * oper_;			// owned by the program's AstArena
+	std::unique_ptr<ExprCode> operand_;
+public:
+	UnaryCode(UnaryOperator * oper, std::unique_ptr<ExprCode> operand) : oper_(oper), operand_(std::move(operand)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		Value operand = operand_->run(engine);
+
+		if constexpr (Path != UnaryPath::GENERIC)
+		{
+			Value result = runUnaryPath(Path, operand);
+			if (!result.isNil())
+				return result;
+		}
+
+		return oper_->perform(operand);
+	}
+};
+
+template <bool IsOr>
+class LogicalCode : public ExprCode
+{
+	std::unique_ptr<ExprCode> left_;
+	std::unique_ptr<ExprCode> right_;
+public:
+	LogicalCode(std::unique_ptr<ExprCode> left, std::unique_ptr<ExprCode> right) : left_(std::move(left)), right_(std::move(right)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		Value left = left_->run(engine);
+		if (!left.isBool())
+			throw Interpreter::InterpreterException("Condition must evaluate to true or false.");
+
+		// a true Or and a false And are decided by their left operand
+		if (left.asBool() == IsOr)
+			return left;
+
+		return right_->run(engine);
+	}
+};
+
+class CallCode : public ExprCode
+{
+	std::unique_ptr<ExprCode> callee_;
+	ExprCodeList args_;
+public:
+	CallCode(std::unique_ptr<ExprCode> callee, ExprCodeList args) : callee_(std::move(callee)), args_(std::move(args)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		return engine.call(callee_->run(engine), nullptr, Value(), args_);
+	}
+};
+
+// obj.m(args) calls the method with obj as "me" instead of binding it first
+class InvokeCode : public ExprCode
+{
+	std::unique_ptr<ExprCode> obj_;
+	Variable::pointer_type name_;
+	ExprCodeList args_;
+	PropertyCache cache_;
+public:
+	InvokeCode(std::unique_ptr<ExprCode> obj, Variable::pointer_type name, ExprCodeList args) : obj_(std::move(obj)), name_(std::move(name)), args_(std::move(args)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		Value receiver = obj_->run(engine);
+		BetaInstance::pointer_type instance = engine.instanceOf(receiver, name_);
+
+		PropertyCache::Entry const * entry = cache_.lookup(instance->getClass(), name_->getName());
+		if (entry == nullptr)
+			return engine.call(instance->get(name_->getName()), nullptr, receiver, args_);	// reports the undefined property
+
+		if (entry->offset_ >= 0)
+			return engine.call(instance->getField(entry->offset_), nullptr, receiver, args_);
+
+		return engine.call(Value(), entry->method_, receiver, args_);
+	}
+};
+
+class GetCode : public ExprCode
+{
+	std::unique_ptr<ExprCode> obj_;
+	Variable::pointer_type name_;
+	PropertyCache cache_;
+public:
+	GetCode(std::unique_ptr<ExprCode> obj, Variable::pointer_type name) : obj_(std::move(obj)), name_(std::move(name)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		BetaInstance::pointer_type instance = engine.instanceOf(obj_->run(engine), name_);
+
+		PropertyCache::Entry const * entry = cache_.lookup(instance->getClass(), name_->getName());
+		if (entry == nullptr)
+			return instance->get(name_->getName());	// reports the undefined property
+
+		if (entry->offset_ >= 0)
+			return instance->getField(entry->offset_);
+
+		return Value(entry->method_->bind(instance));
+	}
+};
+
+class SetCode : public ExprCode
+{
+	std::unique_ptr<ExprCode> obj_;
+	Variable::pointer_type name_;
+	std::unique_ptr<ExprCode> val_;
+	PropertyCache cache_;
+public:
+	SetCode(std::unique_ptr<ExprCode> obj, Variable::pointer_type name, std::unique_ptr<ExprCode> val) : obj_(std::move(obj)), name_(std::move(name)), val_(std::move(val)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		Value obj = obj_->run(engine);
+		if (!obj.isObject() || !is<BetaInstance>(obj.ref()))
+		{
+			stringstream ss;
+			ss << "InterpreterException: " << "\"" << obj.toString() << "\" is not an object.";
+			throw Interpreter::InterpreterException(ss.str().c_str());
+		}
+
+		Value val = val_->run(engine);
+		BetaInstance::pointer_type instance = obj.as<BetaInstance>();
+
+		PropertyCache::Entry const * entry = cache_.lookup(instance->getClass(), name_->getName());
+		if (entry == nullptr || entry->offset_ < 0)
+			instance->set(name_->getName(), val);		// reports the missing field
+		else
+			instance->setField(entry->offset_, val);
+
+		return val;
+	}
+};
+
+class MeCode : public ExprCode
+{
+	unsigned depth_;
+public:
+	MeCode(unsigned depth) : depth_(depth) {}
+	virtual Value run(ClosureEngine & engine) override { return engine.env()->getAt(depth_, 0); }
+};
+
+class SuperCode : public ExprCode
+{
+	unsigned depth_;
+	Variable::pointer_type method_;
+public:
+	SuperCode(unsigned depth, Variable::pointer_type method) : depth_(depth), method_(std::move(method)) {}
+
+	virtual Value run(ClosureEngine & engine) override
+	{
+		BetaClass::pointer_type super = engine.env()->getAt(depth_, 0).as<BetaClass>();
+
+		// the class instance is always one scope below super
+		BetaInstance::pointer_type obj = engine.env()->getAt(depth_ - 1, 0).as<BetaInstance>();
+		CustomFunction::pointer_type method = super->findMethod(obj, method_->getName());
+
+		if (method == nullptr)
+		{
+			stringstream ss;
+			ss << "InterpreterException: \"" << method_->getName() << "\" is undefined.";
+			throw Interpreter::InterpreterException(ss.str().c_str());
+		}
+
+		return Value(method);
+	}
+};
+
+class ExpressionCode : public StmtCode
+{
+	std::unique_ptr<ExprCode> expr_;
+public:
+	ExpressionCode(std::unique_ptr<ExprCode> expr) : expr_(std::move(expr)) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		expr_->run(engine);
+		return Completion::NORMAL;
+	}
+};
+
+class PrintCode : public StmtCode
+{
+	std::unique_ptr<ExprCode> expr_;
+public:
+	PrintCode(std::unique_ptr<ExprCode> expr) : expr_(std::move(expr)) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		cout << expr_->run(engine).toString() << endl;
+		return Completion::NORMAL;
+	}
+};
+
+class ReturnCode : public StmtCode
+{
+	std::unique_ptr<ExprCode> expr_;	// null for a return without a value
+public:
+	ReturnCode(std::unique_ptr<ExprCode> expr) : expr_(std::move(expr)) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		return engine.returnWith(expr_ ? expr_->run(engine) : Value());
+	}
+};
+
+template <bool Checked>
+class DeclareCode : public StmtCode
+{
+	std::unique_ptr<ExprCode> expr_;	// null for a declaration without an initializer
+	VarType type_;
+	unsigned slot_;
+public:
+	DeclareCode(std::unique_ptr<ExprCode> expr, VarType type, unsigned slot) : expr_(std::move(expr)), type_(type), slot_(slot) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		Value val;
+		if (expr_)
+		{
+			val = expr_->run(engine);
+
+			if constexpr (!Checked)
+				if (!Interpreter::checkType(type_, val))
+					throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + val.toString() + "\" to a " + Interpreter::VarTypeName(type_)).c_str());
+		}
+
+		engine.env()->define(slot_, std::move(val));
+		return Completion::NORMAL;
+	}
+};
+
+class FunctionDeclCode : public StmtCode
+{
+	FunctionCode * function_;			// owned by the ClosureProgram
+public:
+	FunctionDeclCode(FunctionCode * function) : function_(function) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		StmtFunc * declaration = function_->declaration_;
+		CustomFunction::pointer_type func = Heap::get().make<CustomFunction>(declaration, engine.env(), false, false, nullptr, function_);
+		engine.env()->define(declaration->slot_, Value(func));
+		return Completion::NORMAL;
+	}
+};
+
+class ClassCode : public StmtCode
+{
+	StmtClass * declaration_;			// owned by the program's AstArena
+	std::unique_ptr<ExprCode> super_;	// null for a class without a superclass
+	std::vector<FunctionCode *> methods_;
+public:
+	ClassCode(StmtClass * declaration, std::unique_ptr<ExprCode> super, std::vector<FunctionCode *> methods) : declaration_(declaration), super_(std::move(super)), methods_(std::move(methods)) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		Value super;
+		if (super_)
+		{
+			super = super_->run(engine);
+			if (!super.isObject() || !is<BetaClass>(super.ref()))
+			{
+				stringstream ss;
+				ss << "InterpreterException: \"" << super.toString() << "\" is not a known class.";
+				throw Interpreter::InterpreterException(ss.str().c_str());
+			}
+		}
+
+		engine.env()->define(declaration_->slot_, Value());
+
+		// super is just inside of the environment the methods close over
+		Environment::pointer_type closure = engine.env();
+		if (super_)
+		{
+			closure = Heap::get().make<Environment>(closure, 1);
+			closure->define(0, super);
+		}
+
+		map<string, CustomFunction::pointer_type> methods;
+		list<Variable::pointer_type> data(declaration_->data_.begin(), declaration_->data_.end());
+
+		for (FunctionCode * method : methods_)
+		{
+			string const& name = method->declaration_->ident_->getName();
+			methods.insert(pair<string, CustomFunction::pointer_type>(name, Heap::get().make<CustomFunction>(method->declaration_, closure, true, name == "init", nullptr, method)));
+		}
+
+		BetaClass::pointer_type cla = Heap::get().make<BetaClass>(declaration_->name_->getName(), super.as<BetaClass>(), data, methods);
+		engine.env()->define(declaration_->slot_, Value(cla));
+		return Completion::NORMAL;
+	}
+};
+
+template <BlockScope S>
+class BlockCode : public StmtCode
+{
+	StmtCodeList statements_;
+	unsigned numSlots_;
+public:
+	BlockCode(StmtCodeList statements, unsigned numSlots) : statements_(std::move(statements)), numSlots_(numSlots) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		if constexpr (S == BlockScope::SHARED)
+			return engine.execute(statements_);
+		else if constexpr (S == BlockScope::HEAP)
+			return engine.executeBlock(statements_, Heap::get().make<Environment>(engine.env(), numSlots_));
+		else
+		{
+			size_t mark = engine.pool().mark();
+			Completion completion = engine.executeBlock(statements_, engine.pool().acquire(engine.env(), numSlots_));
+			engine.pool().release(mark);
+			return completion;
+		}
+	}
+};
+
+class IfCode : public StmtCode
+{
+	std::unique_ptr<ExprCode> cond_;
+	std::unique_ptr<StmtCode> thenBlock_;
+	std::unique_ptr<StmtCode> elseBlock_;	// null without an else
+public:
+	IfCode(std::unique_ptr<ExprCode> cond, std::unique_ptr<StmtCode> thenBlock, std::unique_ptr<StmtCode> elseBlock)
+		: cond_(std::move(cond)), thenBlock_(std::move(thenBlock)), elseBlock_(std::move(elseBlock)) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		Value cond = cond_->run(engine);
+		if (!cond.isBool())
+			throw Interpreter::InterpreterException("InterpreterException: If-Statement condition must evaluate to true or false.");
+
+		if (cond.asBool())
+			return thenBlock_->run(engine);
+
+		return elseBlock_ ? elseBlock_->run(engine) : Completion::NORMAL;
+	}
+};
+
+class WhileCode : public StmtCode
+{
+	std::unique_ptr<ExprCode> cond_;
+	std::unique_ptr<StmtCode> body_;
+public:
+	WhileCode(std::unique_ptr<ExprCode> cond, std::unique_ptr<StmtCode> body) : cond_(std::move(cond)), body_(std::move(body)) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		Value cond = cond_->run(engine);
+		while (cond.isBool() && cond.asBool())
+		{
+			if (body_->run(engine) == Completion::RETURN)
+				return Completion::RETURN;
+
+			cond = cond_->run(engine);
+		}
+
+		if (!cond.isBool())
+			throw Interpreter::InterpreterException("While-loop condition must evaluate to true or false.");
+
+		return Completion::NORMAL;
+	}
+};
+
+class DoWhileCode : public StmtCode
+{
+	std::unique_ptr<ExprCode> cond_;
+	std::unique_ptr<StmtCode> body_;
+public:
+	DoWhileCode(std::unique_ptr<ExprCode> cond, std::unique_ptr<StmtCode> body) : cond_(std::move(cond)), body_(std::move(body)) {}
+
+	virtual Completion run(ClosureEngine & engine) override
+	{
+		Value cond;
+		do
+		{
+			if (body_->run(engine) == Completion::RETURN)
+				return Completion::RETURN;
+
+			cond = cond_->run(engine);
+		}
+		while (cond.isBool() && cond.asBool());
+
+		if (!cond.isBool())
+			throw Interpreter::InterpreterException("Do-While loop condition must evaluate to true or false.");
+
+		return Completion::NORMAL;
+	}
+};
+
+ClosureCompiler::ClosureCompiler() : program_(nullptr)
+{
+}
+
+/**
+@name:		compile
+@purpose:	compiles the program's top-level statements and every function in them
+@param:		std::list<Statement::pointer_type> const &
+@return:	std::unique_ptr<ClosureProgram>
+*/
+std::unique_ptr<ClosureProgram> ClosureCompiler::compile(std::list<Statement::pointer_type> const& statements)
+{
+	std::unique_ptr<ClosureProgram> program = std::make_unique<ClosureProgram>();
+	program_ = program.get();
+
+	// each top-level statement keeps its own node, as the engine advances the position tracker past each one
+	program->script_ = compileStatements(statements);
+
+	program_ = nullptr;
+	return program;
+}
+
+/**
+@name:		compile
+@purpose:	returns the node of an expression
+@param:		Expression::expr_type const &
+@return:	std::unique_ptr<ExprCode>
+*/
+std::unique_ptr<ExprCode> ClosureCompiler::compile(Expression::expr_type const& expr)
+{
+	expr->accept(*this);
+	return std::move(expr_);
+}
+
+/**
+@name:		compile
+@purpose:	returns the node of a statement
+@param:		Statement::pointer_type const &
+@return:	std::unique_ptr<StmtCode>
+*/
+std::unique_ptr<StmtCode> ClosureCompiler::compile(Statement::pointer_type const& statement)
+{
+	statement->accept(*this);
+	return std::move(stmt_);
+}
+
+/**
+@name:		compileStatements
+@purpose:	returns the nodes of a list of statements, in order
+@param:		std::list<Statement::pointer_type> const &
+@return:	StmtCodeList
+*/
+StmtCodeList ClosureCompiler::compileStatements(std::list<Statement::pointer_type> const& statements)
+{
+	StmtCodeList code;
+	code.reserve(statements.size());
+	for (auto const& statement : statements)
+		code.push_back(compile(statement));
+
+	return code;
+}
+
+/**
+@name:		compileFunction
+@purpose:	compiles a function's body once, for every closure later made of it to share
+@param:		StmtFunc *
+@return:	FunctionCode *
+*/
+FunctionCode * ClosureCompiler::compileFunction(StmtFunc * func)
+{
+	program_->functions_.push_back(std::make_unique<FunctionCode>());
+	FunctionCode * code = program_->functions_.back().get();
+	code->declaration_ = func;
+	code->body_ = compileStatements(func->body_);
+	return code;
+}
+
+/**
+@name:		visit
+@purpose:	compiles an assignment to the global or local variable the resolver found
+@param:		AssignExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(AssignExpression * expr)
+{
+	std::unique_ptr<ExprCode> value = compile(expr->expr_);
+	VarType type = expr->oper_->getType();
+
+	if (expr->global_)
+	{
+		if (expr->checked_)
+			expr_ = std::make_unique<AssignCode<Reach::GLOBAL, true>>(std::move(value), type, 0, expr->slot_);
+		else
+			expr_ = std::make_unique<AssignCode<Reach::GLOBAL, false>>(std::move(value), type, 0, expr->slot_);
+	}
+	else if (expr->checked_)
+		expr_ = std::make_unique<AssignCode<Reach::ENCLOSING, true>>(std::move(value), type, expr->depth_, expr->slot_);
+	else
+		expr_ = std::make_unique<AssignCode<Reach::ENCLOSING, false>>(std::move(value), type, expr->depth_, expr->slot_);
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a binary expression into the node with its operator's fast paths
+@param:		BinaryExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(BinaryExpression * expr)
+{
+	std::unique_ptr<ExprCode> left = compile(expr->left_);
+	std::unique_ptr<ExprCode> right = compile(expr->right_);
+	BinaryOperator * oper = expr->oper_.get();
+
+	switch (oper->kind())
+	{
+	case TokenKind::Addition:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_ADD, BinaryPath::FLOAT_ADD>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Subtraction:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_SUB, BinaryPath::FLOAT_SUB>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Multiplication:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_MUL, BinaryPath::FLOAT_MUL>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Division:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_DIV, BinaryPath::FLOAT_DIV>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Modulus:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_MOD, BinaryPath::GENERIC>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Equality:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_EQUAL, BinaryPath::FLOAT_EQUAL>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Inequality:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_NOT_EQUAL, BinaryPath::FLOAT_NOT_EQUAL>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Greater:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_GREATER, BinaryPath::FLOAT_GREATER>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::GreaterEqual:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_GREATER_EQUAL, BinaryPath::FLOAT_GREATER_EQUAL>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::Less:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_LESS, BinaryPath::FLOAT_LESS>>(std::move(left), oper, std::move(right)); break;
+	case TokenKind::LessEqual:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::INT_LESS_EQUAL, BinaryPath::FLOAT_LESS_EQUAL>>(std::move(left), oper, std::move(right)); break;
+	default:
+		expr_ = std::make_unique<BinaryCode<BinaryPath::GENERIC, BinaryPath::GENERIC>>(std::move(left), oper, std::move(right)); break;
+	}
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a call, into a method invocation when the callee is a property
+@param:		CallExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(CallExpression * expr)
+{
+	std::unique_ptr<ExprCode> callee;
+	GetExpression * get = nullptr;
+
+	if (is<GetExpression>(expr->callee_))
+	{
+		get = static_cast<GetExpression*>(expr->callee_.get());
+		callee = compile(get->obj_);
+	}
+	else
+		callee = compile(expr->callee_);
+
+	ExprCodeList args;
+	args.reserve(expr->args_.size());
+	for (auto const& arg : expr->args_)
+		args.push_back(compile(arg));
+
+	if (get != nullptr)
+		expr_ = std::make_unique<InvokeCode>(std::move(callee), get->name_, std::move(args));
+	else
+		expr_ = std::make_unique<CallCode>(std::move(callee), std::move(args));
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a unary expression into the node with its operator's fast path
+@param:		UnaryExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(UnaryExpression * expr)
+{
+	std::unique_ptr<ExprCode> operand = compile(expr->exp_);
+	UnaryOperator * oper = expr->oper_.get();
+
+	if (oper->kind() == TokenKind::Negation)
+		expr_ = std::make_unique<UnaryCode<UnaryPath::INT_NEGATE>>(oper, std::move(operand));
+	else if (oper->kind() == TokenKind::Not)
+		expr_ = std::make_unique<UnaryCode<UnaryPath::BOOL_NOT>>(oper, std::move(operand));
+	else
+		expr_ = std::make_unique<UnaryCode<UnaryPath::GENERIC>>(oper, std::move(operand));
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	a group compiles to the node of its expression
+@param:		GroupExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(GroupExpression * expr)
+{
+	expr_ = compile(expr->expr_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a literal into a node holding its value
+@param:		LiteralExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(LiteralExpression * expr)
+{
+	expr_ = std::make_unique<LiteralCode>(expr->value_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles an And or an Or
+@param:		LogicalExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(LogicalExpression * expr)
+{
+	std::unique_ptr<ExprCode> left = compile(expr->left_);
+	std::unique_ptr<ExprCode> right = compile(expr->right_);
+
+	if (is<Or>(expr->oper_))
+		expr_ = std::make_unique<LogicalCode<true>>(std::move(left), std::move(right));
+	else
+		expr_ = std::make_unique<LogicalCode<false>>(std::move(left), std::move(right));
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a read of the global or local variable the resolver found
+@param:		VariableExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(VariableExpression * expr)
+{
+	if (expr->global_)
+		expr_ = std::make_unique<VariableCode<Reach::GLOBAL>>(0, expr->slot_);
+	else if (expr->depth_ == 0)
+		expr_ = std::make_unique<VariableCode<Reach::LOCAL>>(0, expr->slot_);
+	else
+		expr_ = std::make_unique<VariableCode<Reach::ENCLOSING>>(expr->depth_, expr->slot_);
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a property read
+@param:		GetExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(GetExpression * expr)
+{
+	expr_ = std::make_unique<GetCode>(compile(expr->obj_), expr->name_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a property assignment
+@param:		SetExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(SetExpression * expr)
+{
+	std::unique_ptr<ExprCode> obj = compile(expr->obj_);
+	expr_ = std::make_unique<SetCode>(std::move(obj), expr->name_, compile(expr->val_));
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the "me" keyword
+@param:		MeExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(MeExpression * expr)
+{
+	expr_ = std::make_unique<MeCode>(expr->depth_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a superclass method lookup
+@param:		SuperExpression *
+@return:	Value
+*/
+Value ClosureCompiler::visit(SuperExpression * expr)
+{
+	expr_ = std::make_unique<SuperCode>(expr->depth_, expr->method_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a generic expression statement
+@param:		StmtExpression *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtExpression * expr)
+{
+	stmt_ = std::make_unique<ExpressionCode>(compile(expr->expr_));
+}
+
+/**
+@name:		visit
+@purpose:	compiles a function's body and the statement that closes it over the current environment
+@param:		StmtFunc *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtFunc * expr)
+{
+	stmt_ = std::make_unique<FunctionDeclCode>(compileFunction(expr));
+}
+
+/**
+@name:		visit
+@purpose:	compiles a print statement
+@param:		StmtPrint *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtPrint * expr)
+{
+	stmt_ = std::make_unique<PrintCode>(compile(expr->expr_));
+}
+
+/**
+@name:		visit
+@purpose:	compiles a return statement
+@param:		StmtReturn *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtReturn * expr)
+{
+	stmt_ = std::make_unique<ReturnCode>(expr->expr_ != nullptr ? compile(expr->expr_) : nullptr);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a variable declaration, with a type check unless the type checker proved it needless
+@param:		StmtVariable *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtVariable * expr)
+{
+	std::unique_ptr<ExprCode> init = expr->expr_ != nullptr ? compile(expr->expr_) : nullptr;
+
+	if (expr->checked_)
+		stmt_ = std::make_unique<DeclareCode<true>>(std::move(init), expr->var_->getType(), expr->slot_);
+	else
+		stmt_ = std::make_unique<DeclareCode<false>>(std::move(init), expr->var_->getType(), expr->slot_);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a block into the node for the scope the resolver gave it
+@param:		StmtBlock *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtBlock * expr)
+{
+	StmtCodeList statements = compileStatements(expr->statements_);
+
+	if (expr->numSlots_ == 0)
+		stmt_ = std::make_unique<BlockCode<BlockScope::SHARED>>(std::move(statements), 0);
+	else if (expr->captured_)
+		stmt_ = std::make_unique<BlockCode<BlockScope::HEAP>>(std::move(statements), expr->numSlots_);
+	else
+		stmt_ = std::make_unique<BlockCode<BlockScope::POOLED>>(std::move(statements), expr->numSlots_);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a class's methods and the statement that creates it
+@param:		StmtClass *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtClass * expr)
+{
+	std::vector<FunctionCode *> methods;
+	for (auto const& method : expr->methods_)
+		methods.push_back(compileFunction(method.get()));
+
+	std::unique_ptr<ExprCode> super = expr->super_ != nullptr ? compile(expr->super_) : nullptr;
+	stmt_ = std::make_unique<ClassCode>(expr, std::move(super), std::move(methods));
+}
+
+/**
+@name:		visit
+@purpose:	compiles an if-statement
+@param:		StmtIf *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtIf * expr)
+{
+	std::unique_ptr<ExprCode> cond = compile(expr->expr_);
+	std::unique_ptr<StmtCode> thenBlock = compile(expr->thenBlock_);
+	std::unique_ptr<StmtCode> elseBlock = expr->elseBlock_ != nullptr ? compile(expr->elseBlock_) : nullptr;
+	stmt_ = std::make_unique<IfCode>(std::move(cond), std::move(thenBlock), std::move(elseBlock));
+}
+
+/**
+@name:		visit
+@purpose:	compiles a while-statement
+@param:		StmtWhile *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtWhile * expr)
+{
+	std::unique_ptr<ExprCode> cond = compile(expr->expr_);
+	stmt_ = std::make_unique<WhileCode>(std::move(cond), compile(expr->whileBlock_));
+}
+
+/**
+@name:		visit
+@purpose:	compiles a do while-statement
+@param:		StmtDoWhile *
+@return:	void
+*/
+void ClosureCompiler::visit(StmtDoWhile * expr)
+{
+	std::unique_ptr<ExprCode> cond = compile(expr->expr_);
+	stmt_ = std::make_unique<DoWhileCode>(std::move(cond), compile(expr->whileBlock_));
+}
@@ -0,0 +1,55 @@
+/**	@file closure_compiler.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the closure compiler, which turns resolved statements into nodes for the closure engine
+*/
+
+#pragma once
+#include "visitor.hpp"
+#include "closure_code.hpp"
+#include <list>
+#include <memory>
+
+class ClosureCompiler : public ExprVisitor, public StmtVisitor
+{
+private:
+	ClosureProgram * program_;
+	std::unique_ptr<ExprCode> expr_;	// node of the expression visited last
+	std::unique_ptr<StmtCode> stmt_;	// node of the statement visited last
+
+public:
+	ClosureCompiler();
+	std::unique_ptr<ClosureProgram> compile(std::list<Statement::pointer_type> const& statements);
+
+	virtual Value visit(AssignExpression * expr) override;
+	virtual Value visit(BinaryExpression * expr) override;
+	virtual Value visit(CallExpression * expr) override;
+	virtual Value visit(UnaryExpression * expr) override;
+	virtual Value visit(GroupExpression * expr) override;
+	virtual Value visit(LiteralExpression * expr) override;
+	virtual Value visit(LogicalExpression * expr) override;
+	virtual Value visit(VariableExpression * expr) override;
+	virtual Value visit(GetExpression * expr) override;
+	virtual Value visit(SetExpression * expr) override;
+	virtual Value visit(MeExpression * expr) override;
+	virtual Value visit(SuperExpression * expr) override;
+
+	virtual void visit(StmtExpression * expr) override;
+	virtual void visit(StmtFunc * expr) override;
+	virtual void visit(StmtPrint * expr) override;
+	virtual void visit(StmtReturn * expr) override;
+	virtual void visit(StmtVariable * expr) override;
+	virtual void visit(StmtBlock * expr) override;
+	virtual void visit(StmtClass * expr) override;
+	virtual void visit(StmtIf * expr) override;
+	virtual void visit(StmtWhile * expr) override;
+	virtual void visit(StmtDoWhile * expr) override;
+
+private:
+	std::unique_ptr<ExprCode> compile(Expression::expr_type const& expr);
+	std::unique_ptr<StmtCode> compile(Statement::pointer_type const& statement);
+	StmtCodeList compileStatements(std::list<Statement::pointer_type> const& statements);
+	FunctionCode * compileFunction(StmtFunc * func);
+};
@@ -0,0 +1,260 @@
+/**	@file closure_engine.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of ClosureEngine class
+*/
+
+#include "closure_engine.hpp"
+#include "beta_class.hpp"
+#include "beta_instance.hpp"
+#include "position_tracker.hpp"
+#include <sstream>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#endif
+using namespace std;
+
+// left free below the last call, for the nodes of its body, the native functions they call and throwing
+static size_t const STACK_RESERVE = 128 * 1024;
+
+/**
+@name:		stackLimit
+@purpose:	returns the lowest address the native stack of the current thread may reach while a script call starts
+@param:		null
+@return:	std::uintptr_t
+*/
+static uintptr_t stackLimit()
+{
+#if defined(_WIN32)
+	ULONG_PTR low, high;
+	GetCurrentThreadStackLimits(&low, &high);
+	return low + STACK_RESERVE;
+#else
+#if defined(__linux__)
+	pthread_attr_t attr;
+	if (pthread_getattr_np(pthread_self(), &attr) == 0)
+	{
+		void * low;
+		size_t size;
+		int failed = pthread_attr_getstack(&attr, &low, &size);
+		pthread_attr_destroy(&attr);
+		if (!failed)
+			return reinterpret_cast<uintptr_t>(low) + STACK_RESERVE;
+	}
+#endif
+	// without a way to ask, assume a stack of 1MB that starts here
+	char here;
+	return reinterpret_cast<uintptr_t>(&here) - (1024 * 1024 - STACK_RESERVE);
+#endif
+}
+
+ClosureEngine::ClosureEngine(Environment::pointer_type globals) : env_(globals), globals_(std::move(globals)), stackLimit_(stackLimit())
+{
+}
+
+/**
+@name:		run
+@purpose:	runs every top-level statement of a compiled program
+@param:		ClosureProgram const &
+@return:	void
+*/
+void ClosureEngine::run(ClosureProgram const& program)
+{
+	for (auto const& statement : program.script_)
+	{
+		statement->run(*this);
+		++PositionTracker::itStmtPos_;
+	}
+}
+
+/**
+@name:		execute
+@purpose:	runs statements in the current environment, stopping early at a return
+@param:		StmtCodeList const &
+@return:	Completion
+*/
+Completion ClosureEngine::execute(StmtCodeList const& statements)
+{
+	for (auto const& statement : statements)
+		if (statement->run(*this) == Completion::RETURN)
+			return Completion::RETURN;
+
+	return Completion::NORMAL;
+}
+
+/**
+@name:		executeBlock
+@purpose:	runs statements in a new environment, going back to the current one afterwards
+@param:		StmtCodeList const &, Environment::pointer_type
+@return:	Completion
+*/
+Completion ClosureEngine::executeBlock(StmtCodeList const& statements, Environment::pointer_type env)
+{
+	Environment::pointer_type prev = std::move(env_);
+	env_ = std::move(env);
+
+	Completion completion = execute(statements);
+
+	env_ = std::move(prev);
+	return completion;
+}
+
+/**
+@name:		returnWith
+@purpose:	holds the value of a return statement for the function call it ends
+@param:		Value
+@return:	Completion
+*/
+Completion ClosureEngine::returnWith(Value val)
+{
+	returnValue_ = std::move(val);
+	return Completion::RETURN;
+}
+
+/**
+@name:		call
+@purpose:	evaluates the arguments of a call and calls the callee, or the method with the receiver as "me" if there is one
+@param:		Value const &, CustomFunction *, Value const &, ExprCodeList const &
+@return:	Value
+*/
+Value ClosureEngine::call(Value const& callee, CustomFunction * method, Value const& receiver, ExprCodeList const& args)
+{
+	if (method == nullptr)
+	{
+		if (callee.isNil())
+		{
+			stringstream ss;
+			ss << "\"" << callee.toString() << "\" is not initialized!";
+			throw Interpreter::InterpreterException(ss.str().c_str());
+		}
+
+		if (!callee.isObject() || !is<BetaCallable>(callee.ref()))
+			throw Interpreter::InterpreterException("Can only call functions.");
+	}
+
+	// arguments go onto the shared argument stack and are handed to the callee in place; an error
+	// ends the run, so only a call that returns needs to pop them
+	size_t base = argStack_.size();
+	for (auto const& arg : args)
+		argStack_.push_back(arg->run(*this));
+
+	ArgSpan span(argStack_.data() + base, args.size());
+	BetaCallable * func = method != nullptr ? static_cast<BetaCallable*>(method) : callee.as<BetaCallable>().get();
+	if (span.size() != func->arity())
+	{
+		stringstream ss;
+		ss << "Expected " << func->arity() << " arguments, but received " << span.size() << ".";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	Value result;
+	if (method != nullptr)
+		result = invoke(*method, receiver, span);
+	else if (is<CustomFunction>(callee.ref()))
+	{
+		CustomFunction & custom = static_cast<CustomFunction&>(*func);
+		result = invoke(custom, custom.receiver_, span);
+	}
+	else if (is<BetaClass>(callee.ref()))
+	{
+		BetaClass & clas = static_cast<BetaClass&>(*func);
+		BetaInstance::pointer_type instance = clas.instantiate();
+		CustomFunction::pointer_type init = clas.initializer();
+
+		if (init != nullptr)
+			invoke(*init, Value(instance), span);
+
+		result = Value(instance);
+	}
+	else
+		result = func->call(nullptr, span);		// native functions never look at the interpreter
+
+	argStack_.resize(base);
+	return result;
+}
+
+/**
+@name:		invoke
+@purpose:	runs a function's compiled body, passing the receiver as "me" if the function is a method
+@param:		CustomFunction &, Value const &, ArgSpan
+@return:	Value
+*/
+Value ClosureEngine::invoke(CustomFunction & func, Value const& receiver, ArgSpan args)
+{
+	// each call nests the compiled nodes of its body on the native stack; throw before that runs out
+	char here;
+	if (reinterpret_cast<uintptr_t>(&here) < stackLimit_)
+		throw Interpreter::InterpreterException("Stack overflow.");
+
+	StmtFunc * declaration = func.declaration_;
+
+	// a call whose scope no closure captures borrows its environment from the pool
+	size_t mark = pool_.mark();
+	Environment::pointer_type env = declaration->captured_
+		? Heap::get().make<Environment>(func.closure_, declaration->numSlots_)
+		: pool_.acquire(func.closure_, declaration->numSlots_);
+	unsigned slot = 0;
+
+	if (func.isMethod_)
+		env->define(slot++, receiver);
+
+	for (std::size_t i = 0; i < args.size(); ++i)
+	{
+		VarType type = convert<Variable>(declaration->params_[i])->getType();
+		if (!declaration->argsChecked_ && !Interpreter::checkType(type, args[i]))
+			throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + args[i].toString() + "\" to a " + Interpreter::VarTypeName(type)).c_str());
+
+		env->define(slot++, args[i]);
+	}
+
+	Completion completion = executeBlock(func.code_->body_, std::move(env));
+	pool_.release(mark);
+
+	if (completion == Completion::RETURN)
+	{
+		Value val = std::move(returnValue_);
+		returnValue_ = Value();
+
+		if (func.isInit_ && val.isNil())
+			return receiver;
+
+		if (!declaration->returnsChecked_ && !Interpreter::checkType(declaration->ident_->getType(), val))
+			throw Interpreter::InterpreterException(string("InterpreterException: Cannot return \"" + val.toString() + "\" when expected type is " + Interpreter::VarTypeName(declaration->ident_->getType())).c_str());
+
+		return val;
+	}
+
+	if (func.isInit_)
+		return receiver;
+
+	return Value();
+}
+
+/**
+@name:		instanceOf
+@purpose:	returns the instance whose property is being accessed, or throws if the value is not one
+@param:		Value const &, Variable::pointer_type const &
+@return:	BetaInstance::pointer_type
+*/
+BetaInstance::pointer_type ClosureEngine::instanceOf(Value const& obj, Variable::pointer_type const& name)
+{
+	if (obj.isNil())
+	{
+		stringstream ss;
+		ss << "\"" << name->getName() << "\" is not initialized!";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	if (obj.isObject() && is<BetaInstance>(obj.ref()))
+		return obj.as<BetaInstance>();
+
+	stringstream ss;
+	ss << "InterpreterException: " << "\"" << name->getName() << "\" is not an object.";
+	throw Interpreter::InterpreterException(ss.str().c_str());
+}
@@ -0,0 +1,46 @@
+/**	@file closure_engine.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the closure engine, which runs a program compiled by the ClosureCompiler
+*/
+
+#pragma once
+#include "closure_code.hpp"
+#include "environment.hpp"
+#include "custom_func.hpp"
+#include <cstdint>
+#include <vector>
+
+class BetaInstance;
+
+// The state the compiled nodes share as they run. Each node does its own work and only
+// calls back into the engine for what takes more than one node, such as a function call.
+class ClosureEngine
+{
+private:
+	FramePool pool_;						// environments of the blocks and calls that nothing captures, outlives the handles below
+	Environment::pointer_type env_;
+	Environment::pointer_type globals_;
+	Value returnValue_;						// set by a return statement, taken by the function call it ends
+	std::vector<Value> argStack_;			// arguments of the calls in progress
+	std::uintptr_t stackLimit_;				// script calls nest on the native stack, so none starts below this address
+
+public:
+	ClosureEngine(Environment::pointer_type globals);
+	void run(ClosureProgram const& program);
+
+	Environment::pointer_type const& env() const { return env_; }
+	Environment & globals() { return *globals_; }
+	FramePool & pool() { return pool_; }
+
+	Completion execute(StmtCodeList const& statements);
+	Completion executeBlock(StmtCodeList const& statements, Environment::pointer_type env);
+	Completion returnWith(Value val);
+	Value call(Value const& callee, CustomFunction * method, Value const& receiver, ExprCodeList const& args);
+	Ref<BetaInstance> instanceOf(Value const& obj, Variable::pointer_type const& name);
+
+private:
+	Value invoke(CustomFunction & func, Value const& receiver, ArgSpan args);
+};
@@ -0,0 +1,671 @@
+/**	@file compiler.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of Compiler class
+*/
+
+#include "compiler.hpp"
+#include "superinstructions.hpp"
+#include <limits>
+using namespace std;
+
+Compiler::Compiler() : program_(nullptr), chunk_(nullptr) {}
+
+/**
+@name:		compile
+@purpose:	compiles a resolved program, the statements must have been through the Resolver first
+@param:		std::list<Statement::pointer_type> const &
+@return:	std::unique_ptr<Program>
+*/
+std::unique_ptr<Program> Compiler::compile(std::list<Statement::pointer_type> const& statements)
+{
+	std::unique_ptr<Program> program(new Program());
+	program_ = &*program;
+	chunk_ = &program->script_;
+
+	for (auto const& statement : statements)
+	{
+		compile(statement);
+		emit(OpCode::NEXT_STATEMENT);
+	}
+
+	emit(OpCode::HALT);
+
+#if !defined(BILBY_NO_SUPERINSTRUCTIONS)
+	fuseSuperinstructions(*program);
+#endif
+
+	program_ = nullptr;
+	chunk_ = nullptr;
+	return program;
+}
+
+/**
+@name:		compile
+@purpose:	compiles a single statement
+@param:		Statement::pointer_type const &
+@return:	void
+*/
+void Compiler::compile(Statement::pointer_type const& statement)
+{
+	statement->accept(*this);
+}
+
+/**
+@name:		compileStatements
+@purpose:	compiles a list of statements
+@param:		std::list<Statement::pointer_type> const &
+@return:	void
+*/
+void Compiler::compileStatements(std::list<Statement::pointer_type> const& statements)
+{
+	for (auto const& statement : statements)
+		compile(statement);
+}
+
+/**
+@name:		compile
+@purpose:	compiles an expression, which leaves its value on the stack
+@param:		Expression::expr_type const &
+@return:	void
+*/
+void Compiler::compile(Expression::expr_type const& expr)
+{
+	expr->accept(*this);
+}
+
+/**
+@name:		compileFunction
+@purpose:	compiles a function's body into its own chunk
+@param:		StmtFunc *
+@return:	unsigned - the function's index in the program
+*/
+unsigned Compiler::compileFunction(StmtFunc * func)
+{
+	if (program_->functions_.size() > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Too many functions in one program.");
+
+	unsigned index = static_cast<unsigned>(program_->functions_.size());
+	program_->functions_.emplace_back(new FunctionProto());
+	FunctionProto * proto = &*program_->functions_.back();
+	proto->declaration_ = func;
+
+	Chunk * parChunk = chunk_;
+	chunk_ = &proto->chunk_;
+
+	compileStatements(func->body_);
+	emit(OpCode::LEAVE);
+
+	chunk_ = parChunk;
+	return index;
+}
+
+/**
+@name:		visit
+@purpose:	compiles an assignment, which checks the declared type unless it is proven, and leaves the value on the stack
+@param:		AssignExpression *
+@return:	Value
+*/
+Value Compiler::visit(AssignExpression * expr)
+{
+	compile(expr->expr_);
+	if (!expr->checked_)
+		emit(OpCode::CHECK_TYPE, static_cast<unsigned>(expr->oper_->getType()));
+
+	if (expr->global_)
+		emit(OpCode::SET_GLOBAL, expr->slot_);
+	else
+		emit(OpCode::SET_LOCAL, expr->depth_, expr->slot_);
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles both operands followed by the operator's instruction
+@param:		BinaryExpression *
+@return:	Value
+*/
+Value Compiler::visit(BinaryExpression * expr)
+{
+	compile(expr->left_);
+	compile(expr->right_);
+
+	switch (expr->oper_->kind())
+	{
+	case TokenKind::Power:			emit(OpCode::POWER); break;
+	case TokenKind::Addition:		emit(OpCode::ADD); break;
+	case TokenKind::Subtraction:	emit(OpCode::SUBTRACT); break;
+	case TokenKind::Multiplication:	emit(OpCode::MULTIPLY); break;
+	case TokenKind::Division:		emit(OpCode::DIVIDE); break;
+	case TokenKind::Modulus:		emit(OpCode::MODULUS); break;
+	case TokenKind::And:			emit(OpCode::AND); break;
+	case TokenKind::Nand:			emit(OpCode::NAND); break;
+	case TokenKind::Or:				emit(OpCode::OR); break;
+	case TokenKind::Nor:			emit(OpCode::NOR); break;
+	case TokenKind::Xor:			emit(OpCode::XOR); break;
+	case TokenKind::Xnor:			emit(OpCode::XNOR); break;
+	case TokenKind::Equality:		emit(OpCode::EQUAL); break;
+	case TokenKind::Inequality:		emit(OpCode::NOT_EQUAL); break;
+	case TokenKind::Greater:		emit(OpCode::GREATER); break;
+	case TokenKind::GreaterEqual:	emit(OpCode::GREATER_EQUAL); break;
+	case TokenKind::Less:			emit(OpCode::LESS); break;
+	case TokenKind::LessEqual:		emit(OpCode::LESS_EQUAL); break;
+	default:
+		throw CompilerException("The operator <" + expr->oper_->toString() + "> is not a binary operator.");
+	}
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the callee, checked before any argument runs, then the arguments and the call
+@param:		CallExpression *
+@return:	Value
+*/
+Value Compiler::visit(CallExpression * expr)
+{
+	// obj.m(args) leaves the method and its receiver on the stack rather than a bound method
+	bool invoke = is<GetExpression>(expr->callee_);
+
+	if (invoke)
+	{
+		GetExpression * get = static_cast<GetExpression*>(expr->callee_.get());
+		compile(get->obj_);
+		emit(OpCode::GET_METHOD, addName(get->name_->getName()), addCache());
+	}
+	else
+	{
+		compile(expr->callee_);
+		if (!expr->args_.empty())
+			emit(OpCode::CHECK_CALLABLE);
+	}
+
+	for (auto const& arg : expr->args_)
+		compile(arg);
+
+	emit(invoke ? OpCode::INVOKE : OpCode::CALL, static_cast<unsigned>(expr->args_.size()));
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the operand followed by the operator's instruction
+@param:		UnaryExpression *
+@return:	Value
+*/
+Value Compiler::visit(UnaryExpression * expr)
+{
+	compile(expr->exp_);
+
+	switch (expr->oper_->kind())
+	{
+	case TokenKind::Factorial:	emit(OpCode::FACTORIAL); break;
+	case TokenKind::Identity:	emit(OpCode::IDENTITY); break;
+	case TokenKind::Negation:	emit(OpCode::NEGATE); break;
+	case TokenKind::Not:		emit(OpCode::NOT); break;
+	default:
+		throw CompilerException("The operator <" + expr->oper_->toString() + "> is not a unary operator.");
+	}
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the grouped expression
+@param:		GroupExpression *
+@return:	Value
+*/
+Value Compiler::visit(GroupExpression * expr)
+{
+	compile(expr->expr_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	adds the literal to the constant pool
+@param:		LiteralExpression *
+@return:	Value
+*/
+Value Compiler::visit(LiteralExpression * expr)
+{
+	if (expr->value_.isNil())
+		emit(OpCode::NIL);
+	else
+		emit(OpCode::CONSTANT, addConstant(expr->value_));
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a short-circuiting and/or, the right side is skipped when the left decides the result
+@param:		LogicalExpression *
+@return:	Value
+*/
+Value Compiler::visit(LogicalExpression * expr)
+{
+	compile(expr->left_);
+	size_t jump = emitJump(is<Or>(expr->oper_) ? OpCode::OR_ELSE : OpCode::AND_THEN);
+	compile(expr->right_);
+	patchJump(jump);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	reads a variable from the slot the resolver assigned it
+@param:		VariableExpression *
+@return:	Value
+*/
+Value Compiler::visit(VariableExpression * expr)
+{
+	if (expr->global_)
+		emit(OpCode::GET_GLOBAL, expr->slot_);
+	else
+		emit(OpCode::GET_LOCAL, expr->depth_, expr->slot_);
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the object and reads one of its properties
+@param:		GetExpression *
+@return:	Value
+*/
+Value Compiler::visit(GetExpression * expr)
+{
+	compile(expr->obj_);
+	emit(OpCode::GET_PROPERTY, addName(expr->name_->getName()), addCache());
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the object, checked before the value runs, then the value and the store
+@param:		SetExpression *
+@return:	Value
+*/
+Value Compiler::visit(SetExpression * expr)
+{
+	compile(expr->obj_);
+	emit(OpCode::CHECK_INSTANCE);
+	compile(expr->val_);
+	emit(OpCode::SET_PROPERTY, addName(expr->name_->getName()), addCache());
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	reads "me", the only variable in the environment a method is bound to
+@param:		MeExpression *
+@return:	Value
+*/
+Value Compiler::visit(MeExpression * expr)
+{
+	emit(OpCode::GET_LOCAL, expr->depth_, 0);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	looks up a superclass method
+@param:		SuperExpression *
+@return:	Value
+*/
+Value Compiler::visit(SuperExpression * expr)
+{
+	emit(OpCode::GET_SUPER, expr->depth_, addName(expr->method_->getName()));
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles an expression and discards its value
+@param:		StmtExpression *
+@return:	void
+*/
+void Compiler::visit(StmtExpression * expr)
+{
+	compile(expr->expr_);
+	emit(OpCode::POP);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a function's body and stores a closure over the current environment in its slot
+@param:		StmtFunc *
+@return:	void
+*/
+void Compiler::visit(StmtFunc * expr)
+{
+	unsigned index = compileFunction(expr);
+	emit(OpCode::CLOSURE, index);
+	emit(OpCode::DEFINE, expr->slot_);
+}
+
+/**
+@name:		visit
+@purpose:	compiles the expression to print
+@param:		StmtPrint *
+@return:	void
+*/
+void Compiler::visit(StmtPrint * expr)
+{
+	compile(expr->expr_);
+	emit(OpCode::PRINT);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a return, the returned value is checked against the function's type when it runs
+@param:		StmtReturn *
+@return:	void
+*/
+void Compiler::visit(StmtReturn * expr)
+{
+	if (expr->expr_ != nullptr)
+		compile(expr->expr_);
+	else
+		emit(OpCode::NIL);
+
+	emit(OpCode::RETURN);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a variable's initializer and stores it in the variable's slot
+@param:		StmtVariable *
+@return:	void
+*/
+void Compiler::visit(StmtVariable * expr)
+{
+	if (expr->expr_ != nullptr)
+	{
+		compile(expr->expr_);
+		if (!expr->checked_)
+			emit(OpCode::CHECK_TYPE, static_cast<unsigned>(expr->var_->getType()));
+	}
+	else
+		emit(OpCode::NIL);
+
+	emit(OpCode::DEFINE, expr->slot_);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a block, in a new environment only if the block declares something
+@param:		StmtBlock *
+@return:	void
+*/
+void Compiler::visit(StmtBlock * expr)
+{
+	if (expr->numSlots_ == 0)
+	{
+		compileStatements(expr->statements_);
+		return;
+	}
+
+	emit(expr->captured_ ? OpCode::BEGIN_SCOPE : OpCode::BEGIN_FRAME, expr->numSlots_);
+	compileStatements(expr->statements_);
+	emit(expr->captured_ ? OpCode::END_SCOPE : OpCode::END_FRAME);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a class's methods and stores the class in its slot
+@param:		StmtClass *
+@return:	void
+*/
+void Compiler::visit(StmtClass * expr)
+{
+	if (program_->classes_.size() > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Too many classes in one program.");
+
+	ClassProto proto;
+	proto.declaration_ = expr;
+
+	for (auto const& method : expr->methods_)
+		proto.methods_.push_back(compileFunction(method.get()));
+
+	if (expr->super_ != nullptr)
+	{
+		compile(expr->super_);
+		emit(OpCode::INHERIT);
+	}
+
+	emit(OpCode::CLASS, static_cast<unsigned>(program_->classes_.size()));
+	emit(OpCode::DEFINE, expr->slot_);
+	program_->classes_.push_back(proto);
+}
+
+/**
+@name:		visit
+@purpose:	compiles an if-statement as a conditional jump over the then block
+@param:		StmtIf *
+@return:	void
+*/
+void Compiler::visit(StmtIf * expr)
+{
+	compile(expr->expr_);
+	size_t elseJump = emitJump(OpCode::JUMP_IF_FALSE, Condition::IF);
+	compile(expr->thenBlock_);
+
+	if (expr->elseBlock_ == nullptr)
+	{
+		patchJump(elseJump);
+		return;
+	}
+
+	size_t endJump = emitJump(OpCode::JUMP);
+	patchJump(elseJump);
+	compile(expr->elseBlock_);
+	patchJump(endJump);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a while-statement, the condition is tested before each pass
+@param:		StmtWhile *
+@return:	void
+*/
+void Compiler::visit(StmtWhile * expr)
+{
+	size_t start = chunk_->code_.size();
+	compile(expr->expr_);
+	size_t exitJump = emitJump(OpCode::JUMP_IF_FALSE, Condition::WHILE);
+	compile(expr->whileBlock_);
+	emitLoop(OpCode::LOOP, start);
+	patchJump(exitJump);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a do while-statement, the condition is tested after each pass
+@param:		StmtDoWhile *
+@return:	void
+*/
+void Compiler::visit(StmtDoWhile * expr)
+{
+	size_t start = chunk_->code_.size();
+	compile(expr->whileBlock_);
+	compile(expr->expr_);
+	emitLoop(OpCode::LOOP_IF_TRUE, Condition::DO_WHILE, start);
+}
+
+/**
+@name:		emit
+@purpose:	writes an instruction without operands
+@param:		OpCode
+@return:	void
+*/
+void Compiler::emit(OpCode op)
+{
+	chunk_->code_.push_back(static_cast<uint8_t>(op));
+}
+
+/**
+@name:		emit
+@purpose:	writes an instruction with one operand
+@param:		OpCode, unsigned
+@return:	void
+*/
+void Compiler::emit(OpCode op, unsigned operand)
+{
+	emit(op);
+	emitShort(operand);
+}
+
+/**
+@name:		emit
+@purpose:	writes an instruction with two operands
+@param:		OpCode, unsigned, unsigned
+@return:	void
+*/
+void Compiler::emit(OpCode op, unsigned first, unsigned second)
+{
+	emit(op);
+	emitShort(first);
+	emitShort(second);
+}
+
+/**
+@name:		emitShort
+@purpose:	writes a 16-bit operand
+@param:		unsigned
+@return:	void
+*/
+void Compiler::emitShort(unsigned operand)
+{
+	if (operand > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Operand is too large for an instruction.");
+
+	chunk_->code_.push_back(static_cast<uint8_t>(operand & 0xff));
+	chunk_->code_.push_back(static_cast<uint8_t>(operand >> 8));
+}
+
+/**
+@name:		emitJump
+@purpose:	writes a forward jump with a placeholder offset, and returns where the offset is
+@param:		OpCode
+@return:	std::size_t
+*/
+std::size_t Compiler::emitJump(OpCode op)
+{
+	emit(op, 0);
+	return chunk_->code_.size() - 2;
+}
+
+/**
+@name:		emitJump
+@purpose:	writes a forward conditional jump with a placeholder offset, and returns where the offset is
+@param:		OpCode, Condition
+@return:	std::size_t
+*/
+std::size_t Compiler::emitJump(OpCode op, Condition cond)
+{
+	emit(op, static_cast<unsigned>(cond), 0);
+	return chunk_->code_.size() - 2;
+}
+
+/**
+@name:		patchJump
+@purpose:	points a forward jump at the next instruction to be written
+@param:		std::size_t
+@return:	void
+*/
+void Compiler::patchJump(std::size_t at)
+{
+	size_t offset = chunk_->code_.size() - (at + 2);
+	if (offset > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Too much code to jump over.");
+
+	chunk_->code_[at] = static_cast<uint8_t>(offset & 0xff);
+	chunk_->code_[at + 1] = static_cast<uint8_t>(offset >> 8);
+}
+
+/**
+@name:		emitLoop
+@purpose:	writes a backward jump to the start of a loop
+@param:		OpCode, std::size_t
+@return:	void
+*/
+void Compiler::emitLoop(OpCode op, std::size_t start)
+{
+	emit(op);
+	size_t offset = chunk_->code_.size() + 2 - start;
+	if (offset > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Loop body is too large.");
+
+	emitShort(static_cast<unsigned>(offset));
+}
+
+/**
+@name:		emitLoop
+@purpose:	writes a backward conditional jump to the start of a loop
+@param:		OpCode, Condition, std::size_t
+@return:	void
+*/
+void Compiler::emitLoop(OpCode op, Condition cond, std::size_t start)
+{
+	emit(op);
+	emitShort(static_cast<unsigned>(cond));
+	size_t offset = chunk_->code_.size() + 2 - start;
+	if (offset > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Loop body is too large.");
+
+	emitShort(static_cast<unsigned>(offset));
+}
+
+/**
+@name:		addConstant
+@purpose:	adds a value to the current chunk's constant pool
+@param:		Value const &
+@return:	unsigned - the constant's index
+*/
+unsigned Compiler::addConstant(Value const& val)
+{
+	chunk_->constants_.push_back(val);
+	if (chunk_->constants_.size() > (size_t)(numeric_limits<uint16_t>::max)() + 1)
+		throw CompilerException("CompilerException: Too many constants in one chunk.");
+
+	return static_cast<unsigned>(chunk_->constants_.size() - 1);
+}
+
+/**
+@name:		addName
+@purpose:	adds a property or method name to the current chunk, reusing an existing entry
+@param:		std::string const &
+@return:	unsigned - the name's index
+*/
+unsigned Compiler::addName(std::string const& name)
+{
+	for (size_t i = 0; i < chunk_->names_.size(); ++i)
+		if (chunk_->names_[i] == name)
+			return static_cast<unsigned>(i);
+
+	chunk_->names_.push_back(name);
+	return static_cast<unsigned>(chunk_->names_.size() - 1);
+}
+
+
+/**
+@name:		addCache
+@purpose:	adds an inline cache for one property access to the current chunk
+@param:		null
+@return:	unsigned - the cache's index
+*/
+unsigned Compiler::addCache()
+{
+	chunk_->caches_.emplace_back();
+	if (chunk_->caches_.size() > (size_t)(numeric_limits<uint16_t>::max)() + 1)
+		throw CompilerException("CompilerException: Too many property accesses in one chunk.");
+
+	return static_cast<unsigned>(chunk_->caches_.size() - 1);
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**	@file compiler.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the compiler, which lowers resolved statements into bytecode for the VM
+*/
+
+#pragma once
+#include "visitor.hpp"
+#include "bytecode.hpp"
+#include <list>
+#include <string>
+
+class Compiler : public ExprVisitor, public StmtVisitor
+{
+public:
+	class CompilerException : public std::exception
+	{
+	public:
+		CompilerException(std::string msg) : std::exception(msg.c_str()) {}
+	};
+private:
+	Program * program_;
+	Chunk * chunk_;						// chunk currently being written
+
+public:
+	Compiler();
+	std::unique_ptr<Program> compile(std::list<Statement::pointer_type> const& statements);
+
+	virtual Value visit(AssignExpression * expr) override;
+	virtual Value visit(BinaryExpression * expr) override;
+	virtual Value visit(CallExpression * expr) override;
+	virtual Value visit(UnaryExpression * expr) override;
+	virtual Value visit(GroupExpression * expr) override;
+	virtual Value visit(LiteralExpression * expr) override;
+	virtual Value visit(LogicalExpression * expr) override;
+	virtual Value visit(VariableExpression * expr) override;
+	virtual Value visit(GetExpression * expr) override;
+	virtual Value visit(SetExpression * expr) override;
+	virtual Value visit(MeExpression * expr) override;
+	virtual Value visit(SuperExpression * expr) override;
+
+	virtual void visit(StmtExpression * expr) override;
+	virtual void visit(StmtFunc * expr) override;
+	virtual void visit(StmtPrint * expr) override;
+	virtual void visit(StmtReturn * expr) override;
+	virtual void visit(StmtVariable * expr) override;
+	virtual void visit(StmtBlock * expr) override;
+	virtual void visit(StmtClass * expr) override;
+	virtual void visit(StmtIf * expr) override;
+	virtual void visit(StmtWhile * expr) override;
+	virtual void visit(StmtDoWhile * expr) override;
+
+private:
+	void compile(Statement::pointer_type const& statement);
+	void compileStatements(std::list<Statement::pointer_type> const& statements);
+	void compile(Expression::expr_type const& expr);
+	unsigned compileFunction(StmtFunc * func);
+
+	void emit(OpCode op);
+	void emit(OpCode op, unsigned operand);
+	void emit(OpCode op, unsigned first, unsigned second);
+	void emitShort(unsigned operand);
+	std::size_t emitJump(OpCode op);
+	std::size_t emitJump(OpCode op, Condition cond);
+	void patchJump(std::size_t at);
+	void emitLoop(OpCode op, std::size_t start);
+	void emitLoop(OpCode op, Condition cond, std::size_t start);
+	unsigned addConstant(Value const& val);
+	unsigned addName(std::string const& name);
+	unsigned addCache();
+};
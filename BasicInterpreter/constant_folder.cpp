@@ -0,0 +1,435 @@
+/**	@file constant_folder.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of ConstantFolder class
+*/
+
+#include "constant_folder.hpp"
+#include <exception>
+#include <utility>
+using namespace std;
+
+ConstantFolder::ConstantFolder(AstArena & arena) : arena_(arena), removed_(false)
+{
+}
+
+/**
+@name:		fold
+@purpose:	folds the program's top-level statements, a removed one is left as an empty block, as the
+			position tracker counts on every top-level statement still being there
+@param:		std::list<Statement::pointer_type> &
+@return:	void
+*/
+void ConstantFolder::fold(std::list<Statement::pointer_type> & statements)
+{
+	for (auto & statement : statements)
+		if (!fold(statement))
+			statement = arena_.make<StmtBlock>(std::list<Statement::pointer_type>());
+}
+
+/**
+@name:		fold
+@purpose:	folds an expression, replacing it if it turned out to be constant
+@param:		Expression::expr_type &
+@return:	void
+*/
+void ConstantFolder::fold(Expression::expr_type & expr)
+{
+	expr->accept(*this);
+	if (exprReplacement_)
+		expr = std::move(exprReplacement_);
+}
+
+/**
+@name:		fold
+@purpose:	folds a statement, replacing it if one of its branches can never run, and returns whether it is to be kept
+@param:		Statement::pointer_type &
+@return:	bool
+*/
+bool ConstantFolder::fold(Statement::pointer_type & statement)
+{
+	statement->accept(*this);
+	if (stmtReplacement_)
+		statement = std::move(stmtReplacement_);
+
+	return !std::exchange(removed_, false);
+}
+
+/**
+@name:		foldBody
+@purpose:	folds the body of an if or a loop, which must remain a statement even if it does nothing
+@param:		Statement::pointer_type &
+@return:	void
+*/
+void ConstantFolder::foldBody(Statement::pointer_type & statement)
+{
+	if (!fold(statement))
+		statement = arena_.make<StmtBlock>(std::list<Statement::pointer_type>());
+}
+
+/**
+@name:		foldBlock
+@purpose:	folds a block's statements, removing any that can never run, including all those after a return
+@param:		std::list<Statement::pointer_type> &
+@return:	void
+*/
+void ConstantFolder::foldBlock(std::list<Statement::pointer_type> & statements)
+{
+	auto itStatement = statements.begin();
+	while (itStatement != statements.end())
+	{
+		if (!fold(*itStatement))
+			itStatement = statements.erase(itStatement);
+		else if (is<StmtReturn>(*itStatement++))
+			itStatement = statements.erase(itStatement, statements.end());
+	}
+}
+
+/**
+@name:		constant
+@purpose:	returns an expression as a literal, or null if it is not one
+@param:		Expression::expr_type const &
+@return:	Ref<LiteralExpression>
+*/
+Ref<LiteralExpression> ConstantFolder::constant(Expression::expr_type const& expr)
+{
+	return is<LiteralExpression>(expr) ? static_pointer_cast<LiteralExpression>(expr) : nullptr;
+}
+
+/**
+@name:		replaceWith
+@purpose:	replaces the expression being visited with a literal holding its value
+@param:		Value
+@return:	void
+*/
+void ConstantFolder::replaceWith(Value value)
+{
+	// the literal lives as long as the program, so it may not pin a block of the nursery
+	value.promote();
+	exprReplacement_ = arena_.make<LiteralExpression>(std::move(value));
+}
+
+/**
+@name:		visit
+@purpose:	folds the value of an assignment
+@param:		AssignExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(AssignExpression * expr)
+{
+	fold(expr->expr_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	folds a binary expression whose operands are both constant
+@param:		BinaryExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(BinaryExpression * expr)
+{
+	fold(expr->left_);
+	fold(expr->right_);
+
+	Ref<LiteralExpression> left = constant(expr->left_);
+	Ref<LiteralExpression> right = constant(expr->right_);
+	if (!left || !right)
+		return Value();
+
+	// an operation that fails is left for the run, which reports the error when and where it happens
+	try
+	{
+		replaceWith(expr->oper_->perform(left->value_, right->value_));
+	}
+	catch (exception&) {}
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	folds the callee and arguments of a call
+@param:		CallExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(CallExpression * expr)
+{
+	fold(expr->callee_);
+	for (auto & arg : expr->args_)
+		fold(arg);
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	folds a unary expression whose operand is constant
+@param:		UnaryExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(UnaryExpression * expr)
+{
+	fold(expr->exp_);
+
+	Ref<LiteralExpression> operand = constant(expr->exp_);
+	if (!operand)
+		return Value();
+
+	try
+	{
+		replaceWith(expr->oper_->perform(operand->value_));
+	}
+	catch (exception&) {}
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	replaces a group with its expression once that is constant
+@param:		GroupExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(GroupExpression * expr)
+{
+	fold(expr->expr_);
+
+	if (is<LiteralExpression>(expr->expr_))
+		exprReplacement_ = expr->expr_;
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	a literal is already constant
+@param:		LiteralExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(LiteralExpression *)
+{
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	replaces an And or Or with a constant left operand by the operand that decides its value
+@param:		LogicalExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(LogicalExpression * expr)
+{
+	fold(expr->left_);
+	fold(expr->right_);
+
+	Ref<LiteralExpression> left = constant(expr->left_);
+	if (!left || !left->value_.isBool())
+		return Value();
+
+	// a false And and a true Or give their left operand without evaluating the right one, the others give the right one as it is
+	if (is<Or>(expr->oper_))
+		exprReplacement_ = left->value_.asBool() ? expr->left_ : expr->right_;
+	else if (is<And>(expr->oper_))
+		exprReplacement_ = left->value_.asBool() ? expr->right_ : expr->left_;
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	a variable is never constant
+@param:		VariableExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(VariableExpression *)
+{
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	folds the object of a get expression
+@param:		GetExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(GetExpression * expr)
+{
+	fold(expr->obj_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	folds the object and value of a set expression
+@param:		SetExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(SetExpression * expr)
+{
+	fold(expr->val_);
+	fold(expr->obj_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	the "me" keyword is never constant
+@param:		MeExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(MeExpression *)
+{
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	the "super" keyword is never constant
+@param:		SuperExpression *
+@return:	Value
+*/
+Value ConstantFolder::visit(SuperExpression *)
+{
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	folds the expression of a generic expression statement
+@param:		StmtExpression *
+@return:	void
+*/
+void ConstantFolder::visit(StmtExpression * expr)
+{
+	fold(expr->expr_);
+}
+
+/**
+@name:		visit
+@purpose:	folds the body of a function
+@param:		StmtFunc *
+@return:	void
+*/
+void ConstantFolder::visit(StmtFunc * expr)
+{
+	foldBlock(expr->body_);
+}
+
+/**
+@name:		visit
+@purpose:	folds the expression in a print statement
+@param:		StmtPrint *
+@return:	void
+*/
+void ConstantFolder::visit(StmtPrint * expr)
+{
+	fold(expr->expr_);
+}
+
+/**
+@name:		visit
+@purpose:	folds the expression in a return statement
+@param:		StmtReturn *
+@return:	void
+*/
+void ConstantFolder::visit(StmtReturn * expr)
+{
+	if (expr->expr_)
+		fold(expr->expr_);
+}
+
+/**
+@name:		visit
+@purpose:	folds a variable's initializer
+@param:		StmtVariable *
+@return:	void
+*/
+void ConstantFolder::visit(StmtVariable * expr)
+{
+	if (expr->expr_ != nullptr)
+		fold(expr->expr_);
+}
+
+/**
+@name:		visit
+@purpose:	folds the statements of a block
+@param:		StmtBlock *
+@return:	void
+*/
+void ConstantFolder::visit(StmtBlock * expr)
+{
+	foldBlock(expr->statements_);
+}
+
+/**
+@name:		visit
+@purpose:	folds the bodies of a class's methods
+@param:		StmtClass *
+@return:	void
+*/
+void ConstantFolder::visit(StmtClass * expr)
+{
+	for (auto const& method : expr->methods_)
+		foldBlock(method->body_);
+}
+
+/**
+@name:		visit
+@purpose:	replaces an if-statement whose condition is constant with the branch it always takes
+@param:		StmtIf *
+@return:	void
+*/
+void ConstantFolder::visit(StmtIf * expr)
+{
+	fold(expr->expr_);
+	foldBody(expr->thenBlock_);
+	if (expr->elseBlock_ && !fold(expr->elseBlock_))
+		expr->elseBlock_ = nullptr;
+
+	// a condition that is not a boolean is left for the run to report
+	Ref<LiteralExpression> condition = constant(expr->expr_);
+	if (!condition || !condition->value_.isBool())
+		return;
+
+	if (condition->value_.asBool())
+		stmtReplacement_ = expr->thenBlock_;
+	else if (expr->elseBlock_)
+		stmtReplacement_ = expr->elseBlock_;
+	else
+		removed_ = true;
+}
+
+/**
+@name:		visit
+@purpose:	removes a while statement whose condition is always false
+@param:		StmtWhile *
+@return:	void
+*/
+void ConstantFolder::visit(StmtWhile * expr)
+{
+	fold(expr->expr_);
+	foldBody(expr->whileBlock_);
+
+	Ref<LiteralExpression> condition = constant(expr->expr_);
+	if (condition && condition->value_.isBool() && !condition->value_.asBool())
+		removed_ = true;
+}
+
+/**
+@name:		visit
+@purpose:	replaces a do while-statement whose condition is always false with its block, which runs once
+@param:		StmtDoWhile *
+@return:	void
+*/
+void ConstantFolder::visit(StmtDoWhile * expr)
+{
+	fold(expr->expr_);
+	foldBody(expr->whileBlock_);
+
+	Ref<LiteralExpression> condition = constant(expr->expr_);
+	if (condition && condition->value_.isBool() && !condition->value_.asBool())
+		stmtReplacement_ = expr->whileBlock_;
+}
@@ -0,0 +1,59 @@
+/**	@file constant_folder.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the constant folder, which replaces constant expressions with literals
+			and removes the statements a program can never reach
+*/
+
+#pragma once
+#include "visitor.hpp"
+#include "ast_arena.hpp"
+#include <list>
+
+class ConstantFolder : public ExprVisitor, public StmtVisitor
+{
+private:
+	AstArena & arena_;
+	Expression::expr_type exprReplacement_;		// what the expression visited last is to be replaced with, if anything
+	Statement::pointer_type stmtReplacement_;	// what the statement visited last is to be replaced with, if anything
+	bool removed_;								// the statement visited last can never do anything and is to be removed
+
+public:
+	ConstantFolder(AstArena & arena);
+	void fold(std::list<Statement::pointer_type> & statements);
+
+private:
+	void fold(Expression::expr_type & expr);
+	bool fold(Statement::pointer_type & statement);
+	void foldBody(Statement::pointer_type & statement);
+	void foldBlock(std::list<Statement::pointer_type> & statements);
+	Ref<LiteralExpression> constant(Expression::expr_type const& expr);
+	void replaceWith(Value value);
+
+public:
+	virtual Value visit(AssignExpression * expr) override;
+	virtual Value visit(BinaryExpression * expr) override;
+	virtual Value visit(CallExpression * expr) override;
+	virtual Value visit(UnaryExpression * expr) override;
+	virtual Value visit(GroupExpression * expr) override;
+	virtual Value visit(LiteralExpression * expr) override;
+	virtual Value visit(LogicalExpression * expr) override;
+	virtual Value visit(VariableExpression * expr) override;
+	virtual Value visit(GetExpression * expr) override;
+	virtual Value visit(SetExpression * expr) override;
+	virtual Value visit(MeExpression * expr) override;
+	virtual Value visit(SuperExpression * expr) override;
+
+	virtual void visit(StmtExpression * expr) override;
+	virtual void visit(StmtFunc * expr) override;
+	virtual void visit(StmtPrint * expr) override;
+	virtual void visit(StmtReturn * expr) override;
+	virtual void visit(StmtVariable * expr) override;
+	virtual void visit(StmtBlock * expr) override;
+	virtual void visit(StmtClass * expr) override;
+	virtual void visit(StmtIf * expr) override;
+	virtual void visit(StmtWhile * expr) override;
+	virtual void visit(StmtDoWhile * expr) override;
+};
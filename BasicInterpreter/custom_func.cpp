@@ -7,72 +7,99 @@
 */
 
 #include "custom_func.hpp"
-#include "return.hpp"
 #include "beta_instance.hpp"
 #include <memory>
 using namespace std;
 
 /**
 @name:		bind
-@purpose:	binds the 'me' keyword to a class instance
-@param:		std::shared_ptr<BetaInstance>
+@purpose:	binds the 'me' keyword to a class instance, for a method used as a value rather than called
+@param:		BetaInstance::pointer_type
 @return:	CustomFunction::pointer_type
 */
-CustomFunction::pointer_type CustomFunction::bind(std::shared_ptr<BetaInstance> instance)
+CustomFunction::pointer_type CustomFunction::bind(BetaInstance::pointer_type instance)
 {
-	std::shared_ptr<Environment> env(new Environment(closure_));
-	env->define("me", Token::pointer_type(instance));
-	return CustomFunction::pointer_type(new CustomFunction(declaration_, env, isInit_));
+	CustomFunction::pointer_type bound = Heap::get().make<CustomFunction>(declaration_, closure_, isMethod_, isInit_, proto_, code_, registerProto_);
+	bound->receiver_ = Value(instance);
+	return bound;
 }
 
 /**
-@name:		call
-@purpose:	executes a function call
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@name:		invoke
+@purpose:	executes a function call, passing the receiver as "me" if the function is a method
+@param:		Interpreter *, Value const&, ArgSpan
+@return:	Value
 */
-Token::pointer_type CustomFunction::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value CustomFunction::invoke(Interpreter * interpreter, Value const& receiver, ArgSpan args)
 {
-	auto prevEnv = interpreter->env_;
+	// a call whose scope no closure captures borrows its environment from the pool
+	size_t mark = interpreter->frames_.mark();
+	Environment::pointer_type env = declaration_->captured_
+		? Heap::get().make<Environment>(closure_, declaration_->numSlots_)
+		: interpreter->frames_.acquire(closure_, declaration_->numSlots_);
+	unsigned slot = 0;
 
-	shared_ptr<Environment> env(new Environment(closure_));
+	if (isMethod_)
+		env->define(slot++, receiver);
 
-	auto itParams = declaration_->params_.begin();
-	auto itArgs = args.begin();
-
-	// add parameters to the environment
-	while (itArgs != args.end())
+	// add parameters to the environment, unless the type checker proved every call passes the right types
+	for (std::size_t i = 0; i < args.size(); ++i)
 	{
-		if (!interpreter->checkType(convert<Variable>(*itParams)->getType(), (*itArgs)))
-			throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + (*itArgs)->toString() + "\" to a " + interpreter->VarTypeName(convert<Variable>(*itParams)->getType())).c_str());
+		VarType type = convert<Variable>(declaration_->params_[i])->getType();
+		if (!declaration_->argsChecked_ && !interpreter->checkType(type, args[i]))
+			throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + args[i].toString() + "\" to a " + interpreter->VarTypeName(type)).c_str());
 		
-		env->define((*itParams)->toString(),(*itArgs));
-		++itParams;
-		++itArgs;
+		env->define(slot++, args[i]);
 	}
 
-	try
-	{
-		interpreter->executeBlock(declaration_->body_, env);
-	}
-	catch (ReturnEx &re)
+	Completion completion = interpreter->executeBlock(declaration_->body_, std::move(env));
+	interpreter->frames_.release(mark);
+
+	if (completion == Completion::RETURN)
 	{
-		interpreter->env_ = prevEnv;	// reset the environment in case of a return keyword
+		// the return has reached its function, so the caller continues normally
+		interpreter->completion_ = Completion::NORMAL;
+		Value val = interpreter->returnValue_;
+		interpreter->returnValue_ = Value();
 
 		// return a pointer to this instance if it is the init() function
-		if (isInit_ && re.value_ == nullptr)
-			return closure_->getAt(0, "me");
+		if (isInit_ && val.isNil())
+			return receiver;
 
 		// returned expression did not match the expected return type
-		if (!interpreter->checkType(declaration_->ident_->getType(), re.value_))
-			throw Interpreter::InterpreterException(string("InterpreterException: Cannot return \"" + re.value_->toString() + "\" when expected type is " + interpreter->VarTypeName(declaration_->ident_->getType())).c_str());
+		if (!declaration_->returnsChecked_ && !interpreter->checkType(declaration_->ident_->getType(), val))
+			throw Interpreter::InterpreterException(string("InterpreterException: Cannot return \"" + val.toString() + "\" when expected type is " + interpreter->VarTypeName(declaration_->ident_->getType())).c_str());
 
-		return re.value_;
+		return val;
 	}
 
 	// return a pointer anyway, even in the absense of a return statement
 	if (isInit_) 
-		return closure_->getAt(0, "me");
+		return receiver;
 	
-	return nullptr;
+	return Value();
+}
+
+/**
+@name:		trace
+@purpose:	reports the function's closure and bound receiver to the collector
+@param:		Tracer &
+@return:	void
+*/
+void CustomFunction::trace(Tracer & tracer) const
+{
+	tracer.visit(closure_.get());
+	tracer.visit(receiver_);
+}
+
+/**
+@name:		clearReferences
+@purpose:	drops the closure and receiver of a function the collector found unreachable
+@param:		null
+@return:	void
+*/
+void CustomFunction::clearReferences()
+{
+	closure_.reset();
+	receiver_ = Value();
 }
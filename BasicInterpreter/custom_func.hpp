@@ -8,22 +8,40 @@
 
 #pragma once
 #include "beta_callable.hpp"
+#include "heap.hpp"
 
 class BetaInstance;
-class CustomFunction : public BetaCallable
+struct FunctionProto;
+struct FunctionCode;
+struct RegisterProto;
+class CustomFunction : public BetaCallable, public Collectable
 {
 private:
-	std::shared_ptr<StmtFunc> declaration_;
-	std::shared_ptr<Environment> closure_;
+	StmtFunc * declaration_;		// owned by the program's AstArena
+	Environment::pointer_type closure_;
 	VarType retType_;
+	Value receiver_;				// instance passed as "me" when the method was bound ahead of its call
+	bool isMethod_;
 	bool isInit_;
+	FunctionProto const * proto_;	// compiled body when the function was created by the VM
+	FunctionCode * code_;			// compiled body when the function was created by the closure engine
+	RegisterProto const * registerProto_;	// compiled body when the function was created by the register VM
 public:
 	DEF_POINTER_TYPE(CustomFunction)
 	DEF_IS_CONVERTIBLE_FROM(CustomFunction)
 
-	CustomFunction(std::shared_ptr<StmtFunc> declaration, std::shared_ptr<Environment> closure, bool isInit) : declaration_(declaration), closure_(closure), isInit_(isInit) {}
+	CustomFunction(StmtFunc * declaration, Environment::pointer_type closure, bool isMethod, bool isInit, FunctionProto const * proto = nullptr, FunctionCode * code = nullptr, RegisterProto const * registerProto = nullptr) 
+				: declaration_(declaration), closure_(std::move(closure)), isMethod_(isMethod), isInit_(isInit), proto_(proto), code_(code), registerProto_(registerProto) { kind_ = first_kind; }
 	
-	CustomFunction::pointer_type bind(std::shared_ptr<BetaInstance> instance);
+	CustomFunction::pointer_type bind(Ref<BetaInstance> instance);
 	virtual unsigned short arity() { return static_cast<unsigned short>(declaration_->params_.size()); }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args);
+	virtual Value call(Interpreter * interpreter, ArgSpan args) { return invoke(interpreter, receiver_, args); }
+	Value invoke(Interpreter * interpreter, Value const& receiver, ArgSpan args);
+
+	virtual void trace(Tracer & tracer) const override;
+	virtual void clearReferences() override;
+
+	friend class VM;
+	friend class ClosureEngine;
+	friend class RegisterVM;
 };
\ No newline at end of file
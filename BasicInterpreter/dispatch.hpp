@@ -0,0 +1,142 @@
+/**	@file dispatch.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the kind-by-kind kernel tables used to perform binary operations
+*/
+
+#pragma once
+#include "value.hpp"
+#include "oper_exceptions.hpp"
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+constexpr std::size_t NUM_VALUE_KINDS = static_cast<std::size_t>(Value::Kind::OBJECT) + 1;
+
+using BinaryKernel = Value(*)(Value const&, Value const&);
+using BinaryTable = std::array<std::array<BinaryKernel, NUM_VALUE_KINDS>, NUM_VALUE_KINDS>;
+
+struct KernelEntry
+{
+	Value::Kind first;
+	Value::Kind second;
+	BinaryKernel kernel;
+};
+
+/**
+@name:		noResult
+@purpose:	kernel for pairs involving null or an object, which have never had a result
+@param:		Value const &, Value const &
+@return:	Value
+*/
+inline Value noResult(Value const&, Value const&)
+{
+	return Value();
+}
+
+/**
+@name:		typeError
+@purpose:	kernel for pairs of plain values that an operator does not support
+@param:		Value const &, Value const &
+@return:	Value
+*/
+template <typename Op>
+Value typeError(Value const& first, Value const& second)
+{
+	throw BinOpException(Op::name, first.typeName(), second.typeName());
+}
+
+/**
+@name:		integerKernel
+@purpose:	kernel for two integers
+@param:		Value const &, Value const &
+@return:	Value
+*/
+template <typename Op>
+Value integerKernel(Value const& first, Value const& second)
+{
+	return Op::integers(first, second);
+}
+
+/**
+@name:		floatKernel
+@purpose:	kernel for two numbers where at least one is a float, the other is converted to a float
+@param:		Value const &, Value const &
+@return:	Value
+*/
+template <typename Op>
+Value floatKernel(Value const& first, Value const& second)
+{
+	return Value(Op::floats(first.toFloat(), second.toFloat()));
+}
+
+/**
+@name:		booleanKernel
+@purpose:	kernel for two booleans
+@param:		Value const &, Value const &
+@return:	Value
+*/
+template <typename Op>
+Value booleanKernel(Value const& first, Value const& second)
+{
+	return Value(Op::booleans(first.asBool(), second.asBool()));
+}
+
+/**
+@name:		makeBinaryTable
+@purpose:	builds an operator's table, every pair of plain values not listed is a type error
+@param:		std::initializer_list<KernelEntry>
+@return:	BinaryTable
+*/
+template <typename Op>
+constexpr BinaryTable makeBinaryTable(std::initializer_list<KernelEntry> entries)
+{
+	BinaryTable table{};
+
+	for (std::size_t i = 0; i < NUM_VALUE_KINDS; ++i)
+		for (std::size_t j = 0; j < NUM_VALUE_KINDS; ++j)
+		{
+			bool plain = i != static_cast<std::size_t>(Value::Kind::NIL) && i != static_cast<std::size_t>(Value::Kind::OBJECT) &&
+				j != static_cast<std::size_t>(Value::Kind::NIL) && j != static_cast<std::size_t>(Value::Kind::OBJECT);
+			table[i][j] = plain ? &typeError<Op> : &noResult;
+		}
+
+	for (KernelEntry const& entry : entries)
+		table[static_cast<std::size_t>(entry.first)][static_cast<std::size_t>(entry.second)] = entry.kernel;
+
+	return table;
+}
+
+/**
+@name:		makeNumericTable
+@purpose:	builds a table for an operator on integers and floats, plus any other listed pairs
+@param:		std::initializer_list<KernelEntry>
+@return:	BinaryTable
+*/
+template <typename Op>
+constexpr BinaryTable makeNumericTable(std::initializer_list<KernelEntry> entries = {})
+{
+	BinaryTable table = makeBinaryTable<Op>(entries);
+	constexpr std::size_t INT = static_cast<std::size_t>(Value::Kind::INT);
+	constexpr std::size_t FLOAT = static_cast<std::size_t>(Value::Kind::FLOAT);
+
+	table[INT][INT] = &integerKernel<Op>;
+	table[INT][FLOAT] = &floatKernel<Op>;
+	table[FLOAT][INT] = &floatKernel<Op>;
+	table[FLOAT][FLOAT] = &floatKernel<Op>;
+
+	return table;
+}
+
+/**
+@name:		dispatch
+@purpose:	calls the kernel for the kinds of both operands
+@param:		BinaryTable const &, Value const &, Value const &
+@return:	Value
+*/
+inline Value dispatch(BinaryTable const& table, Value const& first, Value const& second)
+{
+	return table[static_cast<std::size_t>(first.kind())][static_cast<std::size_t>(second.kind())](first, second);
+}
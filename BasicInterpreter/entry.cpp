@@ -11,32 +11,44 @@
 #include "lexer.hpp"
 #include "interpreter.hpp"
 #include "resolver.hpp"
+#include "type_checker.hpp"
+#include "constant_folder.hpp"
+#include "compiler.hpp"
+#include "vm.hpp"
+#include "closure_compiler.hpp"
+#include "closure_engine.hpp"
+#include "register_compiler.hpp"
+#include "register_vm.hpp"
 #include "position_tracker.hpp"
+#include "heap.hpp"
 #include <iostream>
 using namespace std;
 
 /**
 @name:		interpret
-@purpose:	lexes, parses, and interprets the provided string argument
-@param:		std::string
+@purpose:	lexes, parses, and interprets the provided string argument with the chosen engine
+@param:		std::string, Engine
 @return:	void
 */
-void Entry::interpret(std::string text)
+void Entry::interpret(std::string text, Engine engine)
 {
+	// every token and node lives here, so it must outlive the interpreter, the VM and any error report
+	AstArena arena;
+
 	try
 	{
 		PositionTracker::rawCode_ = text;
 		PositionTracker::cursorPosition_ = 0;
 		PositionTracker::stage_ = Stage::RAW;
 
-		Lexer lex;
+		Lexer lex(arena);
 		TokenList list = lex.analyze(PositionTracker::rawCode_);
 
 		PositionTracker::stage_ = Stage::LEXED;
 		PositionTracker::itTokPos_ = PositionTracker::tokenPosition_.cbegin();
 		PositionTracker::cursorPosition_ = 0;
 
-		Parser parse(list);
+		Parser parse(list, arena);
 		Parser::stmt_list stmts = parse.parse();
 
 		PositionTracker::itStmtPos_ = PositionTracker::stmtPosition_.cbegin();
@@ -48,11 +60,51 @@ void Entry::interpret(std::string text)
 
 		PositionTracker::itStmtPos_ = PositionTracker::stmtPosition_.cbegin();
 
-		interpreter.interpret(stmts);
+		TypeChecker checker(&interpreter);
+		checker.check(stmts);
+
+		PositionTracker::itStmtPos_ = PositionTracker::stmtPosition_.cbegin();
+
+		// after the checks, so code that never runs is still checked
+		ConstantFolder folder(arena);
+		folder.fold(stmts);
+
+		if (engine == Engine::BYTECODE)
+		{
+			// the VM shares the interpreter's globals, which hold the native functions the resolver expects
+			Compiler compiler;
+			std::unique_ptr<Program> program = compiler.compile(stmts);
+			VM vm(interpreter.globals());
+			vm.run(*program);
+		}
+		else if (engine == Engine::CLOSURE)
+		{
+			ClosureCompiler compiler;
+			std::unique_ptr<ClosureProgram> program = compiler.compile(stmts);
+			ClosureEngine closures(interpreter.globals());
+			closures.run(*program);
+		}
+		else if (engine == Engine::REGISTER)
+		{
+			// the script keeps the globals in its first registers, after the native functions
+			RegisterCompiler compiler;
+			std::unique_ptr<RegisterProgram> program = compiler.compile(stmts, interpreter.globals()->size());
+			RegisterVM vm(interpreter.globals());
+			vm.run(*program);
+		}
+		else
+			interpreter.interpret(stmts);
 	}
 	catch (exception& ex)
 	{
 		cerr << ex.what() << endl;
 		cerr << PositionTracker::printPosition() << endl;
 	}
+
+	// the program's last cycles, such as a global that refers to itself, are only unreachable once the
+	// interpreter or VM is gone, and must be freed while the literals they may hold are still in the arena
+	Heap::get().collect();
+
+	// the tracker's handles point into the arena
+	PositionTracker::clear();
 }
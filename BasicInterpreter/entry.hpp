@@ -9,8 +9,17 @@
 #pragma once
 #include <string>
 
+// the engine that runs a program once it has been parsed and resolved
+enum class Engine
+{
+	TREE,		// walks the syntax tree with the Interpreter
+	BYTECODE,	// compiles to bytecode and runs it on the VM
+	CLOSURE,	// compiles to a tree of self-running nodes and runs it on the ClosureEngine
+	REGISTER	// compiles to register code and runs it on the RegisterVM
+};
+
 class Entry
 {
 public:
-	static void interpret(std::string text);
+	static void interpret(std::string text, Engine engine = Engine::TREE);
 };
\ No newline at end of file
@@ -9,92 +9,141 @@
 #include "environment.hpp"
 using namespace std;
 
+static Value const nil;
+
 /**
 @name:		define
-@purpose:	adds a variable to the environment's variable map
-@param:		std::string, Token::pointer_type
+@purpose:	stores a variable in its slot, growing the environment if the slot is new
+@param:		unsigned, Value
 @return:	void
 */
-void Environment::define(std::string name, Token::pointer_type var)
+void Environment::define(unsigned slot, Value val)
 {
-	variables_.insert(std::pair<string, Token::pointer_type>(name, var));
-}
+	if (slot >= slots_.size())
+		slots_.resize(slot + 1);
 
-/**
-@name:		reassign
-@purpose:	resets the value of a variable
-@param:		std::string, Token::pointer_type
-@return:	void
-*/
-void Environment::reassign(std::string name, Token::pointer_type var)
-{
-	if (variables_.count(name) == 1)
-		variables_[name] = var;
-	else if (parent_ != nullptr)
-		parent_->reassign(name, var);
-	else
-	{
-		std::string ex = "Variable \"" + name + "\" does not exist in memory.";
-		throw exception(ex.c_str());
-	}
+	// a variable may outlive the expression that made its value, so it is kept out of the nursery
+	if (!pooled_)
+		val.promote();
+	slots_[slot] = std::move(val);
 }
 
 /**
 @name:		reassignAt
 @purpose:	finds a variable in a higher scope, and resets it's value
-@param:		unsigned, std::string, Token::pointer_type
+@param:		unsigned, unsigned, Value
 @return:	void
 */
-void Environment::reassignAt(unsigned dist, std::string name, Token::pointer_type val)
+void Environment::reassignAt(unsigned dist, unsigned slot, Value val)
 {
-	ancestor(dist)->variables_.insert(pair<string, Token::pointer_type>(name, val));
+	ancestor(dist)->define(slot, std::move(val));
 }
 
 /**
 @name:		get
-@purpose:	resets a variable's value
-@param:		std::string
-@return:	Token::pointer_type
+@purpose:	returns a variable in this scope, a declaration that has not run yet is null
+@param:		unsigned
+@return:	Value const &
 */
-Token::pointer_type Environment::get(std::string name)
+Value const& Environment::get(unsigned slot) const
 {
-	Token::pointer_type retVar;
-	if (variables_.count(name) == 1)
-		retVar = variables_.at(name);
-	else if (parent_ != nullptr)
-		retVar = parent_->get(name);
-	else
-	{
-		std::string ex = "Variable \"" + name + "\" does not exist in memory.";
-		throw exception(ex.c_str());
-	}
-
-	return retVar;
+	return slot < slots_.size() ? slots_[slot] : nil;
 }
 
 /**
 @name:		getAt
 @purpose:	finds and returns a variable in a higher scope
-@param:		unsigned, std::string
-@return:	Token::pointer_type
+@param:		unsigned, unsigned
+@return:	Value const &
 */
-Token::pointer_type Environment::getAt(unsigned dist, std::string name)
+Value const& Environment::getAt(unsigned dist, unsigned slot)
 {
-	return ancestor(dist)->variables_.find(name)->second;
+	return ancestor(dist)->get(slot);
 }
 
 /**
 @name:		ancestor
 @purpose:	returns the environment of a certain higher scope
 @param:		unsigned
-@return:	std::shared_ptr<Environment>
+@return:	Environment *
 */
-std::shared_ptr<Environment> Environment::ancestor(unsigned dist)
+Environment * Environment::ancestor(unsigned dist)
 {
-	auto env = shared_from_this();
+	Environment * env = this;
 
 	for (unsigned i = 0; i < dist; ++i)
-		env = env->parent_;
+		env = env->parent_.get();
 
 	return env;
 }
+
+
+/**
+@name:		reset
+@purpose:	reuses the environment for a new scope, with every slot null
+@param:		Environment::pointer_type const &, unsigned
+@return:	void
+*/
+void Environment::reset(Environment::pointer_type const& parent, unsigned size)
+{
+	parent_ = parent;
+	slots_.assign(size, Value());
+}
+
+/**
+@name:		clear
+@purpose:	drops the environment's variables and parent, keeping its storage for reuse
+@param:		null
+@return:	void
+*/
+void Environment::clear()
+{
+	parent_.reset();
+	slots_.clear();
+}
+
+/**
+@name:		trace
+@purpose:	reports the enclosing environment and every variable to the collector
+@param:		Tracer &
+@return:	void
+*/
+void Environment::trace(Tracer & tracer) const
+{
+	tracer.visit(parent_.get());
+	for (auto const& val : slots_)
+		tracer.visit(val);
+}
+
+/**
+@name:		acquire
+@purpose:	returns a pooled environment for a scope that is not captured
+@param:		Environment::pointer_type const &, unsigned
+@return:	Environment::pointer_type
+*/
+Environment::pointer_type FramePool::acquire(Environment::pointer_type const& parent, unsigned size)
+{
+	if (top_ == frames_.size())
+	{
+		// the pool owns its environments, so no handle may delete one
+		frames_.emplace_back();
+		frames_.back().makeImmortal();
+		frames_.back().pooled_ = true;
+	}
+
+	Environment * env = &frames_[top_++];
+	env->reset(parent, size);
+	return Environment::pointer_type(env);
+}
+
+/**
+@name:		release
+@purpose:	returns every environment acquired since the mark to the pool
+@param:		std::size_t
+@return:	void
+*/
+void FramePool::release(std::size_t mark)
+{
+	while (top_ > mark)
+		frames_[--top_].clear();
+}
\ No newline at end of file
@@ -7,23 +7,51 @@
 */
 
 #pragma once
-#include "operand.hpp"
-#include <map>
+#include "value.hpp"
+#include "heap.hpp"
+#include <cstddef>
+#include <deque>
+#include <vector>
 
-class Environment: public std::enable_shared_from_this<Environment>
+// variables are stored in the slot the resolver assigned to their declaration, so no names are kept at runtime
+class Environment : public RefCounted, public Collectable
 {
 public:
-	std::shared_ptr<Environment> parent_;
+	DEF_POINTER_TYPE(Environment)
+
+	pointer_type parent_;
 private:
-	std::map<std::string, Token::pointer_type> variables_;
+	std::vector<Value> slots_;
+	bool pooled_;				// a pooled environment lives no longer than its call, so its values stay young
 public:
-	Environment(std::shared_ptr<Environment> parent = nullptr) : parent_(parent) {}
-	void define(std::string, Token::pointer_type);
-	void reassign(std::string, Token::pointer_type);
-	void reassignAt(unsigned dist, std::string name, Token::pointer_type val);
-	Token::pointer_type get(std::string name);
-	Token::pointer_type getAt(unsigned dist, std::string name);
-	std::shared_ptr<Environment> ancestor(unsigned dist);
+	Environment(pointer_type parent = nullptr, unsigned size = 0) : parent_(std::move(parent)), slots_(size), pooled_(false) {}
+	void define(unsigned slot, Value val);
+	void reassignAt(unsigned dist, unsigned slot, Value val);
+	Value const& get(unsigned slot) const;
+	Value const& getAt(unsigned dist, unsigned slot);
+	Environment * ancestor(unsigned dist);
+	void reset(pointer_type const& parent, unsigned size);
+	void clear();
+	unsigned size() const { return static_cast<unsigned>(slots_.size()); }
+
+	virtual void trace(Tracer & tracer) const override;
+	virtual void clearReferences() override { clear(); }
+
+	friend class FramePool;
+	friend class RegisterVM;
+};
 
-	friend class Resolver;
-};
\ No newline at end of file
+// Environments of scopes that no closure captures, handed out and released in stack order so
+// entering one reuses an earlier environment instead of allocating. The handles do not own them.
+class FramePool
+{
+private:
+	std::deque<Environment> frames_;	// a deque never moves frames that are in use as it grows
+	std::size_t top_;
+public:
+	FramePool() : top_(0) {}
+	~FramePool() { release(0); }		// frames in use may still point at the ones below them
+	Environment::pointer_type acquire(Environment::pointer_type const& parent, unsigned size);
+	std::size_t mark() const { return top_; }
+	void release(std::size_t mark);
+};
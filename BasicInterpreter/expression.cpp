@@ -13,9 +13,9 @@
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor & 
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type BinaryExpression::accept(ExprVisitor & v)
+Value BinaryExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -24,9 +24,9 @@ Token::pointer_type BinaryExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type UnaryExpression::accept(ExprVisitor & v)
+Value UnaryExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -35,9 +35,9 @@ Token::pointer_type UnaryExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type GroupExpression::accept(ExprVisitor & v)
+Value GroupExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -46,9 +46,9 @@ Token::pointer_type GroupExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type LiteralExpression::accept(ExprVisitor & v)
+Value LiteralExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -57,9 +57,9 @@ Token::pointer_type LiteralExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type VariableExpression::accept(ExprVisitor & v)
+Value VariableExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -68,9 +68,9 @@ Token::pointer_type VariableExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type AssignExpression::accept(ExprVisitor & v)
+Value AssignExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -79,9 +79,9 @@ Token::pointer_type AssignExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type LogicalExpression::accept(ExprVisitor & v)
+Value LogicalExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -90,9 +90,9 @@ Token::pointer_type LogicalExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type CallExpression::accept(ExprVisitor & v)
+Value CallExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -101,9 +101,9 @@ Token::pointer_type CallExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type GetExpression::accept(ExprVisitor & v)
+Value GetExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -112,9 +112,9 @@ Token::pointer_type GetExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type SetExpression::accept(ExprVisitor & v)
+Value SetExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -123,9 +123,9 @@ Token::pointer_type SetExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type MeExpression::accept(ExprVisitor & v)
+Value MeExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -134,9 +134,9 @@ Token::pointer_type MeExpression::accept(ExprVisitor & v)
 @name:		accept
 @purpose:	passes a pointer to itself to the Visitor's visit() method
 @param:		ExprVisitor &
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type SuperExpression::accept(ExprVisitor & v)
+Value SuperExpression::accept(ExprVisitor & v)
 {
 	return v.visit(this);
 }
@@ -8,8 +8,12 @@
 
 #pragma once
 #include "operator.hpp"
+#include "fast_path.hpp"
 #include "variable.hpp"
+#include "inline_cache.hpp"
 #include <list>
+#include <utility>
+#include <vector>
 
 class ExprVisitor;
 
@@ -18,10 +22,10 @@ class Expression : public Token
 public:
 	DEF_POINTER_TYPE(Expression)
 	DEF_IS_CONVERTIBLE_FROM(Expression)
-	using expr_type = std::shared_ptr<Expression>;
+	using expr_type = Ref<Expression>;
 	virtual ~Expression() {}
 
-	virtual Token::pointer_type accept(ExprVisitor &v) = 0;
+	virtual Value accept(ExprVisitor &v) = 0;
 };
 
 class AssignExpression : public Expression
@@ -33,12 +37,16 @@ public:
 public:
 	var_type oper_;
 	expr_type expr_;
+	unsigned depth_;	// scopes between the assignment and the declaration, set by the resolver
+	unsigned slot_;		// slot of the declaration within its scope, set by the resolver
+	bool global_;		// declared in the global scope, which is reached directly rather than by depth
+	bool checked_;		// the value always suits the variable's type, set by the type checker
 public:
 	AssignExpression() = delete;
-	AssignExpression(var_type oper, expr_type expr) : oper_(oper), expr_(expr) {}
+	AssignExpression(var_type oper, expr_type expr) : oper_(oper), expr_(expr), depth_(0), slot_(0), global_(false), checked_(false) { kind_ = first_kind; }
 	var_type getValue() { return oper_; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class BinaryExpression : public Expression
@@ -46,16 +54,17 @@ class BinaryExpression : public Expression
 public:
 	DEF_POINTER_TYPE(BinaryExpression)
 		DEF_IS_CONVERTIBLE_FROM(BinaryExpression)
-	using oper_type = std::shared_ptr<BinaryOperator>;
+	using oper_type = Ref<BinaryOperator>;
 public:
 	expr_type left_;
 	oper_type oper_;
 	expr_type right_;
+	BinaryPath path_;	// typed fast path picked by the interpreter on the node's first run
 public:
 	BinaryExpression() = delete;
-	BinaryExpression(expr_type left, oper_type oper, expr_type right) : left_(left), oper_(oper), right_(right) {}
+	BinaryExpression(expr_type left, oper_type oper, expr_type right) : left_(left), oper_(oper), right_(right), path_(BinaryPath::UNSEEN) { kind_ = first_kind; }
 	
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class SetExpression : public Expression
@@ -67,11 +76,12 @@ public:
 	expr_type obj_;
 	Variable::pointer_type name_;
 	expr_type val_;
+	PropertyCache cache_;
 public:
 	SetExpression() = delete;
-	SetExpression(expr_type obj, Variable::pointer_type name, expr_type val) : obj_(obj), name_(name), val_(val) {}
+	SetExpression(expr_type obj, Variable::pointer_type name, expr_type val) : obj_(obj), name_(name), val_(val) { kind_ = first_kind; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class MeExpression : public Expression
@@ -81,11 +91,12 @@ public:
 		DEF_IS_CONVERTIBLE_FROM(MeExpression)
 public:
 	Variable::pointer_type keyword_;
+	unsigned depth_;	// scopes between the expression and the bound instance, set by the resolver
 public:
 	MeExpression() = delete;
-	MeExpression(Variable::pointer_type keyword) : keyword_(keyword) {}
+	MeExpression(Variable::pointer_type keyword) : keyword_(keyword), depth_(0) { kind_ = first_kind; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class SuperExpression : public Expression
@@ -96,11 +107,12 @@ public:
 public:
 	Variable::pointer_type keyword_;
 	Variable::pointer_type method_;
+	unsigned depth_;	// scopes between the expression and the superclass, set by the resolver
 public:
 	SuperExpression() = delete;
-	SuperExpression(Variable::pointer_type keyword, Variable::pointer_type method) : keyword_(keyword), method_(method) {}
+	SuperExpression(Variable::pointer_type keyword, Variable::pointer_type method) : keyword_(keyword), method_(method), depth_(0) { kind_ = first_kind; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class CallExpression : public Expression
@@ -108,16 +120,17 @@ class CallExpression : public Expression
 public:
 	DEF_POINTER_TYPE(CallExpression)
 		DEF_IS_CONVERTIBLE_FROM(CallExpression)
-		using paren_type = std::shared_ptr<RightBracket>;
+		using paren_type = Ref<RightBracket>;
 public:
 	expr_type callee_;
 	paren_type paren_;
-	std::list<expr_type> args_;
+	std::vector<expr_type> args_;
+	PropertyCache cache_;		// method lookups when the callee is a property, as in obj.m(args)
 public:
 	CallExpression() = delete;
-	CallExpression(expr_type callee, paren_type paren, std::list<expr_type> args) : callee_(callee), paren_(paren), args_(args) {}
+	CallExpression(expr_type callee, paren_type paren, std::vector<expr_type> args) : callee_(callee), paren_(paren), args_(args) { kind_ = first_kind; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class GetExpression : public Expression
@@ -128,11 +141,12 @@ public:
 public:
 	expr_type obj_;
 	Variable::pointer_type name_;
+	PropertyCache cache_;
 public:
 	GetExpression() = delete;
-	GetExpression(expr_type obj, Variable::pointer_type name) : obj_(obj), name_(name) {}
+	GetExpression(expr_type obj, Variable::pointer_type name) : obj_(obj), name_(name) { kind_ = first_kind; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class UnaryExpression : public Expression
@@ -140,15 +154,16 @@ class UnaryExpression : public Expression
 public:
 	DEF_POINTER_TYPE(UnaryExpression)
 		DEF_IS_CONVERTIBLE_FROM(UnaryExpression)
-	using oper_type = std::shared_ptr<UnaryOperator>;
+	using oper_type = Ref<UnaryOperator>;
 public:
 	oper_type oper_;
 	expr_type exp_;
+	UnaryPath path_;	// typed fast path picked by the interpreter on the node's first run
 public:
 	UnaryExpression() = delete;
-	UnaryExpression(oper_type oper, expr_type exp) : oper_(oper), exp_(exp) {}
+	UnaryExpression(oper_type oper, expr_type exp) : oper_(oper), exp_(exp), path_(UnaryPath::UNSEEN) { kind_ = first_kind; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class GroupExpression : public Expression
@@ -157,13 +172,13 @@ public:
 	DEF_POINTER_TYPE(GroupExpression)
 		DEF_IS_CONVERTIBLE_FROM(GroupExpression)
 	expr_type expr_;
-	std::shared_ptr<LeftBracket> left_;
-	std::shared_ptr<RightBracket> right_;
+	Ref<LeftBracket> left_;
+	Ref<RightBracket> right_;
 public:
 	GroupExpression() = delete;
-	GroupExpression(expr_type expr): left_(new LeftBracket()), expr_(expr), right_(new RightBracket()) {}
+	GroupExpression(expr_type expr): left_(new LeftBracket()), expr_(expr), right_(new RightBracket()) { kind_ = first_kind; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class LiteralExpression : public Expression
@@ -171,15 +186,17 @@ class LiteralExpression : public Expression
 public:
 	DEF_POINTER_TYPE(LiteralExpression)
 		DEF_IS_CONVERTIBLE_FROM(LiteralExpression)
-	using oper_type = std::shared_ptr<Operand>;
+	using oper_type = Ref<Operand>;
 public:
 	oper_type oper_;
+	Value value_;
 public:
 	LiteralExpression() = delete;
-	LiteralExpression(oper_type oper) : oper_(oper) {}
+	LiteralExpression(oper_type oper) : oper_(oper), value_(oper) { kind_ = first_kind; }
+	LiteralExpression(Value value) : value_(std::move(value)) { kind_ = first_kind; }	// a constant folded from an expression, with no token of its own
 	oper_type getValue() { return oper_; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class LogicalExpression : public Expression
@@ -187,17 +204,17 @@ class LogicalExpression : public Expression
 public:
 	DEF_POINTER_TYPE(LogicalExpression)
 		DEF_IS_CONVERTIBLE_FROM(LogicalExpression)
-		using oper_type = std::shared_ptr<BinaryOperator>;
+		using oper_type = Ref<BinaryOperator>;
 public:
 	expr_type left_;
 	oper_type oper_;
 	expr_type right_;
 public:
 	LogicalExpression() = delete;
-	LogicalExpression(expr_type left, oper_type oper, expr_type right) : left_(left), oper_(oper), right_(right) {}
+	LogicalExpression(expr_type left, oper_type oper, expr_type right) : left_(left), oper_(oper), right_(right) { kind_ = first_kind; }
 	oper_type getValue() { return oper_; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
 
 class VariableExpression : public Expression
@@ -208,10 +225,13 @@ public:
 	using var_type = Variable::pointer_type;
 public:
 	var_type oper_;
+	unsigned depth_;	// scopes between the reference and the declaration, set by the resolver
+	unsigned slot_;		// slot of the declaration within its scope, set by the resolver
+	bool global_;		// declared in the global scope, which is reached directly rather than by depth
 public:
 	VariableExpression() = delete;
-	VariableExpression(var_type oper) : oper_(oper) {}
+	VariableExpression(var_type oper) : oper_(oper), depth_(0), slot_(0), global_(false) { kind_ = first_kind; }
 	var_type getValue() { return oper_; }
 
-	Token::pointer_type accept(ExprVisitor &v) override final;
+	Value accept(ExprVisitor &v) override final;
 };
\ No newline at end of file
@@ -0,0 +1,68 @@
+/**	@file fast_path.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of the choice of an operator expression's fast path
+*/
+
+#include "fast_path.hpp"
+
+/**
+@name:		chooseBinaryPath
+@purpose:	picks the fast path for an operator and the operands of its first run, GENERIC if there is none
+@param:		BinaryOperator const &, Value const &, Value const &
+@return:	BinaryPath
+*/
+BinaryPath chooseBinaryPath(BinaryOperator const& oper, Value const& first, Value const& second)
+{
+	if (first.isInt() && second.isInt())
+	{
+		if (is<Addition>(&oper))			return BinaryPath::INT_ADD;
+		if (is<Subtraction>(&oper))			return BinaryPath::INT_SUB;
+		if (is<Multiplication>(&oper))		return BinaryPath::INT_MUL;
+		if (is<Division>(&oper))			return BinaryPath::INT_DIV;
+		if (is<Modulus>(&oper))				return BinaryPath::INT_MOD;
+		if (is<Equality>(&oper))			return BinaryPath::INT_EQUAL;
+		if (is<Inequality>(&oper))			return BinaryPath::INT_NOT_EQUAL;
+		if (is<Greater>(&oper))				return BinaryPath::INT_GREATER;
+		if (is<GreaterEqual>(&oper))		return BinaryPath::INT_GREATER_EQUAL;
+		if (is<Less>(&oper))				return BinaryPath::INT_LESS;
+		if (is<LessEqual>(&oper))			return BinaryPath::INT_LESS_EQUAL;
+	}
+	else if (first.isNumber() && second.isNumber())
+	{
+		// the modulus of a float is an error, which is the generic path's to report
+		if (is<Addition>(&oper))			return BinaryPath::FLOAT_ADD;
+		if (is<Subtraction>(&oper))			return BinaryPath::FLOAT_SUB;
+		if (is<Multiplication>(&oper))		return BinaryPath::FLOAT_MUL;
+		if (is<Division>(&oper))			return BinaryPath::FLOAT_DIV;
+		if (is<Equality>(&oper))			return BinaryPath::FLOAT_EQUAL;
+		if (is<Inequality>(&oper))			return BinaryPath::FLOAT_NOT_EQUAL;
+		if (is<Greater>(&oper))				return BinaryPath::FLOAT_GREATER;
+		if (is<GreaterEqual>(&oper))		return BinaryPath::FLOAT_GREATER_EQUAL;
+		if (is<Less>(&oper))				return BinaryPath::FLOAT_LESS;
+		if (is<LessEqual>(&oper))			return BinaryPath::FLOAT_LESS_EQUAL;
+	}
+	else if (is<Addition>(&oper) && (first.isWord() || second.isWord()))
+		return BinaryPath::WORD_CONCAT;
+
+	return BinaryPath::GENERIC;
+}
+
+/**
+@name:		chooseUnaryPath
+@purpose:	picks the fast path for an operator and the operand of its first run, GENERIC if there is none
+@param:		UnaryOperator const &, Value const &
+@return:	UnaryPath
+*/
+UnaryPath chooseUnaryPath(UnaryOperator const& oper, Value const& operand)
+{
+	if (is<Negation>(&oper) && operand.isSmallInt())
+		return UnaryPath::INT_NEGATE;
+
+	if (is<Not>(&oper) && operand.isBool())
+		return UnaryPath::BOOL_NOT;
+
+	return UnaryPath::GENERIC;
+}
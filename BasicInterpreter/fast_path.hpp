@@ -0,0 +1,116 @@
+/**	@file fast_path.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the typed fast paths that operator expressions specialize themselves to
+*/
+
+#pragma once
+#include "operator.hpp"
+#include "value.hpp"
+#include "checked_math.hpp"
+#include <limits>
+
+// An operator expression starts out UNSEEN, picks the path for the operands of its first run, and falls
+// back to GENERIC, the operator's perform(), for good the first time its operands fail the path's guard.
+// Variables are typed, so most expressions never leave the path they picked.
+enum class BinaryPath : unsigned char
+{
+	UNSEEN,
+	INT_ADD, INT_SUB, INT_MUL, INT_DIV, INT_MOD,
+	INT_EQUAL, INT_NOT_EQUAL, INT_GREATER, INT_GREATER_EQUAL, INT_LESS, INT_LESS_EQUAL,
+	FLOAT_ADD, FLOAT_SUB, FLOAT_MUL, FLOAT_DIV,
+	FLOAT_EQUAL, FLOAT_NOT_EQUAL, FLOAT_GREATER, FLOAT_GREATER_EQUAL, FLOAT_LESS, FLOAT_LESS_EQUAL,
+	WORD_CONCAT,
+	GENERIC
+};
+
+enum class UnaryPath : unsigned char { UNSEEN, INT_NEGATE, BOOL_NOT, GENERIC };
+
+BinaryPath chooseBinaryPath(BinaryOperator const& oper, Value const& first, Value const& second);
+UnaryPath chooseUnaryPath(UnaryOperator const& oper, Value const& operand);
+
+/**
+@name:		runBinaryPath
+@purpose:	performs an operation on a fast path, which never gives null, so null means the operands failed
+			its guard and the result, errors included, is the generic path's to give
+@param:		BinaryPath, Value const &, Value const &
+@return:	Value
+*/
+inline Value runBinaryPath(BinaryPath path, Value const& first, Value const& second)
+{
+	// integer paths take two 64-bit integers and give up on an overflow, a zero divisor, or the one quotient that overflows
+	if (path <= BinaryPath::INT_LESS_EQUAL)
+	{
+		if (!first.isSmallInt() || !second.isSmallInt())
+			return Value();
+
+		std::int64_t a = first.asSmallInt(), b = second.asSmallInt(), res;
+		switch (path)
+		{
+		case BinaryPath::INT_ADD:			return checkedAdd(a, b, res) ? Value() : Value(res);
+		case BinaryPath::INT_SUB:			return checkedSub(a, b, res) ? Value() : Value(res);
+		case BinaryPath::INT_MUL:			return checkedMul(a, b, res) ? Value() : Value(res);
+		case BinaryPath::INT_EQUAL:			return Value(a == b);
+		case BinaryPath::INT_NOT_EQUAL:		return Value(a != b);
+		case BinaryPath::INT_GREATER:		return Value(a > b);
+		case BinaryPath::INT_GREATER_EQUAL:	return Value(a >= b);
+		case BinaryPath::INT_LESS:			return Value(a < b);
+		case BinaryPath::INT_LESS_EQUAL:	return Value(a <= b);
+		default:
+			if (b == 0 || (b == -1 && a == (std::numeric_limits<std::int64_t>::min)()))
+				return Value();
+			return Value(std::int64_t(path == BinaryPath::INT_DIV ? a / b : a % b));
+		}
+	}
+
+	// float paths take any two numbers of which at least one is a float, as the operators convert the other
+	if (path <= BinaryPath::FLOAT_LESS_EQUAL)
+	{
+		if (!first.isNumber() || !second.isNumber() || (first.isInt() && second.isInt()))
+			return Value();
+
+		Float::value_type a = first.toFloat(), b = second.toFloat();
+		switch (path)
+		{
+		case BinaryPath::FLOAT_ADD:				return Value(Float::value_type(a + b));
+		case BinaryPath::FLOAT_SUB:				return Value(Float::value_type(a - b));
+		case BinaryPath::FLOAT_MUL:				return Value(Float::value_type(a * b));
+		case BinaryPath::FLOAT_DIV:				return Value(Float::value_type(a / b));
+		case BinaryPath::FLOAT_EQUAL:			return Value(a == b);
+		case BinaryPath::FLOAT_NOT_EQUAL:		return Value(a != b);
+		case BinaryPath::FLOAT_GREATER:			return Value(a > b);
+		case BinaryPath::FLOAT_GREATER_EQUAL:	return Value(a >= b);
+		case BinaryPath::FLOAT_LESS:			return Value(a < b);
+		default:								return Value(a <= b);
+		}
+	}
+
+	// a word joins with any value that is neither null nor an object
+	bool plain = !first.isNil() && !first.isObject() && !second.isNil() && !second.isObject();
+	if (path != BinaryPath::WORD_CONCAT || !plain || (!first.isWord() && !second.isWord()))
+		return Value();
+
+	return Value(first.toString() + second.toString());
+}
+
+/**
+@name:		runUnaryPath
+@purpose:	performs an operation on a fast path, or returns null if the operand fails its guard
+@param:		UnaryPath, Value const &
+@return:	Value
+*/
+inline Value runUnaryPath(UnaryPath path, Value const& operand)
+{
+	if (path == UnaryPath::INT_NEGATE && operand.isSmallInt())
+	{
+		// negation makes a number negative rather than flipping its sign
+		return operand.asSmallInt() > 0 ? Value(-operand.asSmallInt()) : operand;
+	}
+
+	if (path == UnaryPath::BOOL_NOT && operand.isBool())
+		return Value(!operand.asBool());
+
+	return Value();
+}
@@ -8,6 +8,8 @@
 
 #include "float.hpp"
 #include <boost/lexical_cast.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <sstream>
 
 /**
 @name:		toString
@@ -17,5 +19,33 @@
 */
 Float::string_type Float::toString() const
 {
-	return boost::lexical_cast<string_type>(getValue());
+	return format(getValue());
+}
+
+/**
+@name:		parse
+@purpose:	converts the text of a float literal to the selected precision, rounding once
+@param:		string_type const &
+@return:	value_type
+*/
+Float::value_type Float::parse(string_type const& text)
+{
+	return boost::lexical_cast<value_type>(text);
+}
+
+/**
+@name:		format
+@purpose:	prints a float with the default stream precision, so every backend prints the same text for finite values
+			and infinities; a native NaN is printed as "nan", since the C++ libraries print its sign and payload differently
+@param:		value_type const &
+@return:	string_type
+*/
+Float::string_type Float::format(value_type const& value)
+{
+	if (is_native && (boost::math::isnan)(value))
+		return "nan";
+
+	std::ostringstream ss;
+	ss << value;
+	return ss.str();
 }
@@ -9,27 +9,67 @@
 #pragma once
 
 #include "number.hpp"
-#include <boost/multiprecision/cpp_dec_float.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/number.hpp>
+#include <cmath>
+#include <type_traits>
+
+/* The float precision is chosen per build by defining one of
+	BILBY_FLOAT_BIN50		50 decimal digits (cpp_bin_float_50)
+	BILBY_FLOAT_BIN100		100 decimal digits (cpp_bin_float_100)
+	BILBY_FLOAT_DEC1000		1000 decimal digits (cpp_dec_float<1000>)
+   otherwise floats are native IEEE doubles. */
+#if defined(BILBY_FLOAT_DEC1000)
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#elif defined(BILBY_FLOAT_BIN50) || defined(BILBY_FLOAT_BIN100)
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#endif
 
 class Float : public Number
 {
 public:
 	DEF_POINTER_TYPE(Float)
+	DEF_IS_CONVERTIBLE_FROM(Float)
+#if defined(BILBY_FLOAT_DEC1000)
 	using value_type = boost::multiprecision::number < boost::multiprecision::cpp_dec_float<1000, int32_t, void> >;
+#elif defined(BILBY_FLOAT_BIN100)
+	using value_type = boost::multiprecision::cpp_bin_float_100;
+#elif defined(BILBY_FLOAT_BIN50)
+	using value_type = boost::multiprecision::cpp_bin_float_50;
+#else
+	using value_type = double;
+#endif
+	static constexpr bool is_native = std::is_same<value_type, double>::value;
 private:
 	value_type value_;
 public:
-	Float(value_type value = 0.0) : value_(value) {}
+	Float(value_type value = 0.0) : value_(value) { kind_ = first_kind; }
 
-	value_type getValue() const { return value_; }
+	value_type const& getValue() const { return value_; }
 	string_type toString() const override;
+
+	static value_type parse(string_type const& text);
+	static string_type format(value_type const& value);
 };
 
+// math functions that resolve to std:: for native floats and boost::multiprecision:: otherwise
+namespace float_math
+{
+	using std::abs;		using boost::multiprecision::abs;
+	using std::atan;	using boost::multiprecision::atan;
+	using std::cos;		using boost::multiprecision::cos;
+	using std::exp;		using boost::multiprecision::exp;
+	using std::log10;	using boost::multiprecision::log10;
+	using std::pow;		using boost::multiprecision::pow;
+	using std::sin;		using boost::multiprecision::sin;
+	using std::sqrt;	using boost::multiprecision::sqrt;
+	using std::tan;		using boost::multiprecision::tan;
+}
+
 class Pi : public Float
 {
 public:
-	Pi() : Float(boost::math::constants::pi<value_type>()) {}
+	Pi() : Float(boost::math::constants::pi<value_type>()) { kind_ = first_kind; }
 
 	DEF_IS_CONVERTIBLE_FROM(Pi)
 };
@@ -37,7 +77,7 @@ public:
 class E : public Float
 {
 public:
-	E() : Float(boost::math::constants::e<value_type>()) {}
+	E() : Float(boost::math::constants::e<value_type>()) { kind_ = first_kind; }
 
 	DEF_IS_CONVERTIBLE_FROM(E)
 };
\ No newline at end of file
@@ -0,0 +1,197 @@
+/**	@file heap.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of Heap
+*/
+
+#include "heap.hpp"
+#include "value.hpp"
+#include "custom_func.hpp"
+#include "beta_class.hpp"
+#include "beta_instance.hpp"
+#include <algorithm>
+using namespace std;
+
+/**
+@name:		visit
+@purpose:	reports the object a value refers to, if it is one the collector tracks
+@param:		Value const &
+@return:	void
+*/
+void Tracer::visit(Value const& val)
+{
+	if (!val.isObject())
+		return;
+
+	Token::pointer_type const& ref = val.ref();
+	if (is<CustomFunction>(ref))
+		visit(static_cast<CustomFunction const *>(ref.get()));
+	else if (is<BetaInstance>(ref))
+		visit(static_cast<BetaInstance const *>(ref.get()));
+	else if (is<BetaClass>(ref))
+		visit(static_cast<BetaClass const *>(ref.get()));
+}
+
+Collectable::~Collectable()
+{
+	if (heapSlot_ != NOT_TRACKED)
+		Heap::get().forget(*this);
+}
+
+Heap::Heap() : allocated_(0), threshold_(10000), minThreshold_(10000), growth_(2.0) {}
+
+/**
+@name:		get
+@purpose:	returns the heap shared by every interpreter and VM in the process
+@param:		null
+@return:	Heap &
+*/
+Heap& Heap::get()
+{
+	// never destroyed, since objects in static storage may still be freed at exit
+	static Heap * heap = new Heap();
+	return *heap;
+}
+
+/**
+@name:		setThreshold
+@purpose:	sets the fewest objects created between collections, and how far the limit grows with the heap
+@param:		std::size_t, double
+@return:	void
+*/
+void Heap::setThreshold(std::size_t minimum, double growth)
+{
+	minThreshold_ = minimum;
+	growth_ = growth;
+	threshold_ = max(minThreshold_, static_cast<size_t>(objects_.size() * growth_));
+}
+
+/**
+@name:		track
+@purpose:	adds a new object to the heap, collecting first if enough objects have been created
+@param:		Collectable *, RefCounted *
+@return:	void
+*/
+void Heap::track(Collectable * obj, RefCounted * counted)
+{
+	if (++allocated_ >= threshold_)
+		collect();
+
+	obj->heapSlot_ = objects_.size();
+	objects_.push_back(Entry{ obj, counted });
+}
+
+/**
+@name:		compact
+@purpose:	forgets the objects that reference counting already freed
+@param:		null
+@return:	void
+*/
+void Heap::compact()
+{
+	size_t live = 0;
+	for (auto const& entry : objects_)
+	{
+		if (entry.obj_ == nullptr)
+			continue;
+
+		entry.obj_->heapSlot_ = live;
+		objects_[live++] = entry;
+	}
+
+	objects_.resize(live);
+}
+
+/**
+@name:		collect
+@purpose:	frees every object that is only reachable from other unreachable objects
+@param:		null
+@return:	void
+*/
+void Heap::collect()
+{
+	compact();
+
+	vector<size_t> external(objects_.size());
+	for (size_t i = 0; i < objects_.size(); ++i)
+		external[i] = objects_[i].counted_->refCount();
+
+	// take away the references tracked objects hold to each other
+	struct Internal : Tracer
+	{
+		vector<size_t>& external_;
+		Internal(vector<size_t>& external) : external_(external) {}
+		using Tracer::visit;
+		void visit(Collectable const * obj) override
+		{
+			if (obj != nullptr && obj->heapSlot_ != Collectable::NOT_TRACKED)
+				--external_[obj->heapSlot_];
+		}
+	} internal(external);
+
+	for (auto const& entry : objects_)
+		entry.obj_->trace(internal);
+
+	// anything referenced from outside the heap is alive, and so is everything it reaches
+	vector<bool> marked(objects_.size(), false);
+	vector<size_t> work;
+	for (size_t i = 0; i < objects_.size(); ++i)
+		if (external[i] > 0)
+		{
+			marked[i] = true;
+			work.push_back(i);
+		}
+
+	struct Marker : Tracer
+	{
+		vector<bool>& marked_;
+		vector<size_t>& work_;
+		Marker(vector<bool>& marked, vector<size_t>& work) : marked_(marked), work_(work) {}
+		using Tracer::visit;
+		void visit(Collectable const * obj) override
+		{
+			if (obj != nullptr && obj->heapSlot_ != Collectable::NOT_TRACKED && !marked_[obj->heapSlot_])
+			{
+				marked_[obj->heapSlot_] = true;
+				work_.push_back(obj->heapSlot_);
+			}
+		}
+	} marker(marked, work);
+
+	while (!work.empty())
+	{
+		size_t i = work.back();
+		work.pop_back();
+		objects_[i].obj_->trace(marker);
+	}
+
+	// the rest only keep each other alive, so breaking their references lets their counts reach zero
+	vector<Ref<RefCounted>> holds;		// keeps the garbage alive until every cycle is broken
+	vector<Collectable *> garbage;
+	size_t live = 0;
+	for (size_t i = 0; i < objects_.size(); ++i)
+	{
+		Entry entry = objects_[i];
+		if (marked[i])
+		{
+			entry.obj_->heapSlot_ = live;
+			objects_[live++] = entry;
+		}
+		else
+		{
+			entry.obj_->heapSlot_ = Collectable::NOT_TRACKED;
+			holds.emplace_back(entry.counted_);
+			garbage.push_back(entry.obj_);
+		}
+	}
+
+	objects_.resize(live);
+	for (auto obj : garbage)
+		obj->clearReferences();
+	holds.clear();
+
+	allocated_ = 0;
+	threshold_ = max(minThreshold_, static_cast<size_t>(objects_.size() * growth_));
+}
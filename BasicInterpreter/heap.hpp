@@ -0,0 +1,96 @@
+/**	@file heap.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the collector that frees reference cycles between runtime objects
+*/
+
+#pragma once
+#include "ref.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+class Value;
+class Collectable;
+
+// receives every reference a collectable object holds
+class Tracer
+{
+public:
+	virtual ~Tracer() {}
+	virtual void visit(Collectable const * obj) = 0;
+	void visit(Value const& val);
+};
+
+// An object that can take part in a reference cycle. trace() must report each Ref the object
+// owns exactly once; leaving one out only keeps garbage alive, but reporting extra ones frees live objects.
+class Collectable
+{
+private:
+	static std::size_t const NOT_TRACKED = static_cast<std::size_t>(-1);
+	std::size_t heapSlot_;		// index of the object's entry in the heap
+
+	friend class Heap;
+
+public:
+	Collectable() : heapSlot_(NOT_TRACKED) {}
+	Collectable(Collectable const&) : heapSlot_(NOT_TRACKED) {}
+	Collectable& operator=(Collectable const&) { return *this; }
+	virtual ~Collectable();
+
+	virtual void trace(Tracer & tracer) const = 0;
+	virtual void clearReferences() = 0;
+};
+
+// Reference counting frees most objects as soon as they are unused; the heap finds the cycles it
+// cannot. Whatever part of an object's count is not explained by other tracked objects comes from
+// outside the heap (the interpreter, the VM's stacks, locals), so those objects are the roots.
+class Heap
+{
+private:
+	struct Entry
+	{
+		Collectable * obj_;			// null once reference counting has freed the object
+		RefCounted * counted_;		// the same object, seen through its reference count
+	};
+
+	std::vector<Entry> objects_;
+	std::size_t allocated_;			// objects created since the last collection
+	std::size_t threshold_;			// collect once this many objects have been created
+	std::size_t minThreshold_;
+	double growth_;					// the next threshold, as a multiple of the objects that survived
+
+public:
+	static Heap& get();
+
+	template <typename T, typename... Args>
+	Ref<T> make(Args&&... args);
+
+	void collect();
+	void setThreshold(std::size_t minimum, double growth);
+	std::size_t size() const { return objects_.size(); }
+
+private:
+	Heap();
+	void track(Collectable * obj, RefCounted * counted);
+	void forget(Collectable const& obj) { objects_[obj.heapSlot_].obj_ = nullptr; }
+	void compact();
+
+	friend class Collectable;
+};
+
+/**
+@name:		make
+@purpose:	creates an object the collector keeps track of
+@param:		Args&&...
+@return:	Ref<T>
+*/
+template <typename T, typename... Args>
+Ref<T> Heap::make(Args&&... args)
+{
+	Ref<T> obj(new T(std::forward<Args>(args)...));
+	track(obj.get(), obj.get());
+	return obj;
+}
@@ -0,0 +1,46 @@
+/**	@file inline_cache.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of PropertyCache
+*/
+
+#include "inline_cache.hpp"
+#include "beta_class.hpp"
+
+/**
+@name:		lookup
+@purpose:	returns what a name resolves to on a class, or null if it is neither a field nor a method
+@param:		BetaClass const &, std::string const &
+@return:	PropertyCache::Entry const *
+*/
+PropertyCache::Entry const * PropertyCache::lookup(BetaClass const& clas, std::string const& name)
+{
+	for (unsigned i = 0; i < size_; ++i)
+		if (entries_[i].classId_ == clas.id_)
+			return &entries_[i];
+
+	// fields hide methods of the same name
+	int offset = clas.fieldOffset(name);
+	CustomFunction * method = nullptr;
+	if (offset < 0)
+	{
+		method = clas.lookupMethod(name).get();
+		if (method == nullptr)
+			return nullptr;
+	}
+
+	// a site that sees more classes than it can hold keeps cycling through its entries
+	Entry * entry;
+	if (size_ < SIZE)
+		entry = &entries_[size_++];
+	else
+	{
+		entry = &entries_[next_];
+		next_ = (next_ + 1) % SIZE;
+	}
+
+	*entry = Entry{ clas.id_, offset, method };
+	return entry;
+}
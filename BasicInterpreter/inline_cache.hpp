@@ -0,0 +1,40 @@
+/**	@file inline_cache.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the per-site cache of property lookups on class instances
+*/
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class BetaClass;
+class CustomFunction;
+
+// Remembers what a property name resolved to for the last few classes seen at one site. A class's
+// fields and methods never change once it is created, so an entry never has to be invalidated.
+class PropertyCache
+{
+public:
+	static unsigned const SIZE = 4;
+
+	struct Entry
+	{
+		std::uint64_t classId_;
+		int offset_;								// field offset, or -1 for a method
+		CustomFunction * method_;					// unbound method when offset_ is -1, owned by the class
+	};
+
+private:
+	std::array<Entry, SIZE> entries_;
+	unsigned size_;
+	unsigned next_;		// entry replaced next once the cache is full
+
+public:
+	PropertyCache() : size_(0), next_(0) {}
+	Entry const * lookup(BetaClass const& clas, std::string const& name);
+};
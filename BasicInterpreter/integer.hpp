@@ -19,9 +19,9 @@ public:
 private:
 	value_type value_;
 public:
-	Integer(value_type value = 0) : value_(value) {}
+	Integer(value_type value = 0) : value_(value) { kind_ = first_kind; }
 
-	value_type getValue() const { return value_; }
+	value_type const& getValue() const { return value_; }
 	string_type toString() const override;
 
 	DEF_IS_CONVERTIBLE_FROM(Integer)
@@ -16,18 +16,16 @@
 #include "math_func.hpp"
 #include "misc_func.hpp"
 #include "custom_func.hpp"
-#include "return.hpp"
 #include "beta_instance.hpp"
 #include "beta_class.hpp"
 #include "position_tracker.hpp"
-#include <stack>
 #include <iostream>
 #include <sstream>
 using namespace std;
 
-Interpreter::Interpreter()
+Interpreter::Interpreter() : completion_(Completion::NORMAL)
 {
-	globals_.reset(new Environment());
+	globals_ = Heap::get().make<Environment>();
 	prepareNativeFunctions();
 	env_ = globals_;
 }
@@ -42,6 +40,8 @@ std::string Interpreter::VarTypeName(VarType type)
 {
 	if (type == VarType::BOOL)
 		return "bool";
+	else if (type == VarType::NUMBER)
+		return "number";
 	else if (type == VarType::INT)
 		return "int";
 	else if (type == VarType::FLOAT)
@@ -58,16 +58,16 @@ std::string Interpreter::VarTypeName(VarType type)
 /**
 @name:		checkType
 @purpose:	ensures the variable and the value being assigned to it are the same type
-@param:		Variable::VarType, Token::pointer_type
+@param:		Variable::VarType, Value const &
 @return:	bool
 */
-bool Interpreter::checkType(VarType type, Token::pointer_type val)
+bool Interpreter::checkType(VarType type, value_type const& val)
 {
-	if ((type == VarType::BOOL && is<Boolean>(val)) ||
-		(type == VarType::NUMBER && (is<Number>(val))) ||
-		(type == VarType::WORD && is<Word>(val)) ||
-		type == VarType::OBJECT && is<BetaInstance>(val) ||
-		type == VarType::VOID_TYPE && !val)
+	if ((type == VarType::BOOL && val.isBool()) ||
+		(type == VarType::NUMBER && val.isNumber()) ||
+		(type == VarType::WORD && val.isWord()) ||
+		type == VarType::OBJECT && val.isObject() && is<BetaInstance>(val.ref()) ||
+		type == VarType::VOID_TYPE && val.isNil())
 		return true;
 
 	return false;
@@ -77,22 +77,20 @@ bool Interpreter::checkType(VarType type, Token::pointer_type val)
 @name:		visit
 @purpose:	reassigns a variable in an Assignment Expression
 @param:		AssignExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(AssignExpression * expr)
+Value Interpreter::visit(AssignExpression * expr)
 {
-	tok_type val = evaluate(expr->expr_);
+	value_type val = evaluate(expr->expr_);
 	VarType type = expr->oper_->getType();
 
-	if (!checkType(type, val))
-		throw InterpreterException(string("InterpreterException: Cannot assign \"" + val->toString() + "\" to a " + VarTypeName(type)).c_str());
+	if (!expr->checked_ && !checkType(type, val))
+		throw InterpreterException(string("InterpreterException: Cannot assign \"" + val.toString() + "\" to a " + VarTypeName(type)).c_str());
 
-	//env_->reassign(expr->oper_->getName(), val);
-	auto itVar = locals_.find(expr);
-	if (itVar != locals_.end())
-		env_->reassignAt(itVar->second, expr->oper_->getName(), val);
+	if (expr->global_)
+		globals_->define(expr->slot_, val);
 	else
-		globals_->reassign(expr->oper_->getName(), val);
+		env_->reassignAt(expr->depth_, expr->slot_, val);
 
 	return val;
 }
@@ -101,51 +99,93 @@ Token::pointer_type Interpreter::visit(AssignExpression * expr)
 @name:		visit
 @purpose:	Evaluates a Binary Expression and its operands
 @param:		BinaryExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(BinaryExpression * expr)
+Value Interpreter::visit(BinaryExpression * expr)
 {
-	tok_type left = evaluate(expr->left_);
-	tok_type right = evaluate(expr->right_);
-	
-	if (!is<BinaryOperator>(expr->oper_))
+	value_type left = evaluate(expr->left_);
+	value_type right = evaluate(expr->right_);
+
+	// the node specializes itself to the operand types of its first run, and goes back to perform() for good once they change
+	if (expr->path_ == BinaryPath::UNSEEN)
+		expr->path_ = chooseBinaryPath(*expr->oper_, left, right);
+
+	value_type result = expr->path_ != BinaryPath::GENERIC ? runBinaryPath(expr->path_, left, right) : value_type();
+
+	if (result.isNil())
 	{
-		stringstream ex;
-		ex << "The operator <" + expr->oper_->toString() + "> is not a binary operator.";
-		throw exception(ex.str().c_str());
+		if (!is<BinaryOperator>(expr->oper_))
+		{
+			stringstream ex;
+			ex << "The operator <" + expr->oper_->toString() + "> is not a binary operator.";
+			throw exception(ex.str().c_str());
+		}
+
+		expr->path_ = BinaryPath::GENERIC;
+		result = expr->oper_->perform(left, right);
 	}
 
-	stack<oper_type> operStack;
-	operStack.push(convert<Operand>(right));
-	operStack.push(convert<Operand>(left));
-	return convert<Token>(expr->oper_->perform(operStack));
+	return result;
 }
 
+// pops a call's arguments off the argument stack however the call ends
+struct ArgFrame
+{
+	vector<Value>& stack_;
+	size_t base_;
+	~ArgFrame() { stack_.resize(base_); }
+};
+
 /**
 @name:		visit
 @purpose:	Evaluates and calls a function in a Call Expression
 @param:		CallExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(CallExpression * expr)
+Value Interpreter::visit(CallExpression * expr)
 {
-	tok_type callee = evaluate(expr->callee_);
+	value_type callee;
+	value_type receiver;
+	CustomFunction * method = nullptr;		// owned by the receiver's class
 
-	if (callee == nullptr)
+	// obj.m(args) calls the method with obj as "me" instead of binding it first
+	if (is<GetExpression>(expr->callee_))
 	{
-		stringstream ss;
-		ss << "\"" << callee->toString() << "\" is not initialized!";
-		throw InterpreterException(ss.str().c_str());
+		GetExpression * get = static_cast<GetExpression*>(expr->callee_.get());
+		receiver = evaluate(get->obj_);
+		BetaInstance::pointer_type instance = instanceOf(receiver, get->name_);
+
+		PropertyCache::Entry const * entry = expr->cache_.lookup(instance->getClass(), get->name_->getName());
+		if (entry == nullptr)
+			callee = instance->get(get->name_->getName());	// reports the undefined property
+		else if (entry->offset_ >= 0)
+			callee = instance->getField(entry->offset_);
+		else
+			method = entry->method_;
+	}
+	else
+		callee = evaluate(expr->callee_);
+
+	if (method == nullptr)
+	{
+		if (callee.isNil())
+		{
+			stringstream ss;
+			ss << "\"" << callee.toString() << "\" is not initialized!";
+			throw InterpreterException(ss.str().c_str());
+		}
+
+		if (!callee.isObject() || !is<BetaCallable>(callee.ref()))
+			throw InterpreterException("Can only call functions.");
 	}
-		
-	if (!is<BetaCallable>(callee))
-		throw InterpreterException("Can only call functions.");
 	
-	list<tok_type> args;
-	for (auto arg : expr->args_)
-		args.push_back(evaluate(arg));
+	// arguments go onto the shared argument stack and are handed to the callee in place
+	ArgFrame frame{ argStack_, argStack_.size() };
+	for (auto const& arg : expr->args_)
+		argStack_.push_back(evaluate(arg));
 
-	BetaCallable::pointer_type func = convert<BetaCallable>(callee);
+	ArgSpan args(argStack_.data() + frame.base_, expr->args_.size());
+	BetaCallable * func = method != nullptr ? static_cast<BetaCallable*>(method) : callee.as<BetaCallable>().get();
 	if (args.size() != func->arity())
 	{
 		stringstream ss;
@@ -153,6 +193,9 @@ Token::pointer_type Interpreter::visit(CallExpression * expr)
 		throw InterpreterException(ss.str().c_str());
 	}
 
+	if (method != nullptr)
+		return method->invoke(this, receiver, args);
+
 	return func->call(this, args);
 }
 
@@ -160,30 +203,40 @@ Token::pointer_type Interpreter::visit(CallExpression * expr)
 @name:		visit
 @purpose:	Evaluates and returns a Unary Expression
 @param:		UnaryExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(UnaryExpression * expr)
+Value Interpreter::visit(UnaryExpression * expr)
 {
-	tok_type right = evaluate(expr->exp_);
-	if (!is<UnaryOperator>(expr->oper_))
+	value_type right = evaluate(expr->exp_);
+
+	if (expr->path_ == UnaryPath::UNSEEN)
+		expr->path_ = chooseUnaryPath(*expr->oper_, right);
+
+	value_type result = expr->path_ != UnaryPath::GENERIC ? runUnaryPath(expr->path_, right) : value_type();
+
+	if (result.isNil())
 	{
-		stringstream ex;
-		ex << "The operator <" + expr->oper_->toString() + "> is not a unary operator.";
-		throw exception(ex.str().c_str());
+		if (!is<UnaryOperator>(expr->oper_))
+		{
+			stringstream ex;
+			ex << "The operator <" + expr->oper_->toString() + "> is not a unary operator.";
+			throw exception(ex.str().c_str());
+		}
+
+		expr->path_ = UnaryPath::GENERIC;
+		result = expr->oper_->perform(right);
 	}
 
-	stack<oper_type> operStack;
-	operStack.push(convert<Operand>(right));
-	return convert<Token>(expr->oper_->perform(operStack));
+	return result;
 }
 
 /**
 @name:		visit
 @purpose:	Evaluates and returns a Group Expression
 @param:		GroupExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(GroupExpression * expr)
+Value Interpreter::visit(GroupExpression * expr)
 {
 	return evaluate(expr->expr_);
 }
@@ -192,44 +245,50 @@ Token::pointer_type Interpreter::visit(GroupExpression * expr)
 @name:		visit
 @purpose:	Evaluates and returns a Literal Expression
 @param:		LiteralExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(LiteralExpression * expr)
+Value Interpreter::visit(LiteralExpression * expr)
 {
-	return convert<Token>(expr->getValue());
+	return expr->value_;
 }
 
 /**
 @name:		visit
 @purpose:	returns a variable stored in an environment
 @param:		VariableExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(VariableExpression * expr)
+Value Interpreter::visit(VariableExpression * expr)
 {
-	return lookUpVariable(expr->oper_->getName(), expr);
+	if (expr->global_)
+		return globals_->get(expr->slot_);
+
+	return env_->getAt(expr->depth_, expr->slot_);
 }
 
 /**
 @name:		visit
 @purpose:	Evaluates and returns the result of a logical expression
 @param:		LogicalExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(LogicalExpression * expr)
+Value Interpreter::visit(LogicalExpression * expr)
 {
-	tok_type left = evaluate(expr->left_);
+	value_type left = evaluate(expr->left_);
 
-	if (is<Boolean>(left))
+	if (left.isBool())
 	{
-		Boolean::pointer_type cond = convert<Boolean>(left);
 		if (is<Or>(expr->oper_))
-			if (cond->getValue() == true)	// an Or statement in which the first statement is true
+		{
+			if (left.asBool() == true)	// an Or statement in which the first statement is true
 				return left;
+		}
 		else if (is<And>(expr->oper_))
-			if (cond->getValue() == false)	// an And statement in which the first statement is false
+		{
+			if (left.asBool() == false)	// an And statement in which the first statement is false
 				return left;
-		else if (!is<Or>(expr->oper_) || !is<And>(expr->oper_))
+		}
+		else
 			throw InterpreterException("Condition must evaluate to true or false.");
 
 		return evaluate(expr->right_);
@@ -242,24 +301,42 @@ Token::pointer_type Interpreter::visit(LogicalExpression * expr)
 @name:		visit
 @purpose:	Returns a variable stored in a Beta object
 @param:		GetExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(GetExpression * expr)
+Value Interpreter::visit(GetExpression * expr)
 {
-	tok_type obj = evaluate(expr->obj_);
+	BetaInstance::pointer_type instance = instanceOf(evaluate(expr->obj_), expr->name_);
+
+	PropertyCache::Entry const * entry = expr->cache_.lookup(instance->getClass(), expr->name_->getName());
+	if (entry == nullptr)
+		return instance->get(expr->name_->getName());	// reports the undefined property
+
+	if (entry->offset_ >= 0)
+		return instance->getField(entry->offset_);
 
-	if (obj == nullptr)
+	return value_type(entry->method_->bind(instance));
+}
+
+/**
+@name:		instanceOf
+@purpose:	Returns the instance whose property is being accessed, or throws if the value is not one
+@param:		value_type const&, Variable::pointer_type const&
+@return:	BetaInstance::pointer_type
+*/
+BetaInstance::pointer_type Interpreter::instanceOf(value_type const& obj, Variable::pointer_type const& name)
+{
+	if (obj.isNil())
 	{
 		stringstream ss;
-		ss << "\"" << expr->name_->getName() << "\" is not initialized!";
+		ss << "\"" << name->getName() << "\" is not initialized!";
 		throw InterpreterException(ss.str().c_str());
 	}
 
-	if (is<BetaInstance>(obj))
-		return convert<BetaInstance>(obj)->get(expr->name_->getName());
+	if (obj.isObject() && is<BetaInstance>(obj.ref()))
+		return obj.as<BetaInstance>();
 
 	stringstream ss;
-	ss << "InterpreterException: " << "\"" << expr->name_->getName() << "\" is not an object.";
+	ss << "InterpreterException: " << "\"" << name->getName() << "\" is not an object.";
 	throw InterpreterException(ss.str().c_str());
 }
 
@@ -267,49 +344,56 @@ Token::pointer_type Interpreter::visit(GetExpression * expr)
 @name:		visit
 @purpose:	Sets a variable stored in a Beta object
 @param:		SetExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(SetExpression * expr)
+Value Interpreter::visit(SetExpression * expr)
 {
-	tok_type obj = evaluate(expr->obj_);
+	value_type obj = evaluate(expr->obj_);
 
-	if (!is<BetaInstance>(obj))
+	if (!obj.isObject() || !is<BetaInstance>(obj.ref()))
 	{
 		stringstream ss;
-		ss << "InterpreterException: " << "\"" << obj->toString() << "\" is not an object.";
+		ss << "InterpreterException: " << "\"" << obj.toString() << "\" is not an object.";
 		throw InterpreterException(ss.str().c_str());
 	}
 
-	Token::pointer_type val = evaluate(expr->val_);
-	convert<BetaInstance>(obj)->set(expr->name_->getName(), val);
+	value_type val = evaluate(expr->val_);
+	BetaInstance::pointer_type instance = obj.as<BetaInstance>();
+
+	PropertyCache::Entry const * entry = expr->cache_.lookup(instance->getClass(), expr->name_->getName());
+	if (entry == nullptr || entry->offset_ < 0)
+		instance->set(expr->name_->getName(), val);		// reports the missing field
+	else
+		instance->setField(entry->offset_, val);
+
 	return val;
-		
 }
 
 /**
 @name:		visit
 @purpose:	Returns a pointer to a BetaClass instance
 @param:		MeExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(MeExpression * expr)
+Value Interpreter::visit(MeExpression * expr)
 {
-	return lookUpVariable(expr->keyword_->getName(), expr);
+	// "me" is the only variable in the environment a method is bound to
+	return env_->getAt(expr->depth_, 0);
 }
 
 /**
 @name:		visit
 @purpose:	Returns a class method found in a parent class
 @param:		SuperExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Interpreter::visit(SuperExpression * expr)
+Value Interpreter::visit(SuperExpression * expr)
 {
-	unsigned dist = locals_.find(expr)->second;	// find the correct scope
-	BetaClass::pointer_type super = convert<BetaClass>(env_->getAt(dist, "super"));
+	unsigned dist = expr->depth_;	// find the correct scope
+	BetaClass::pointer_type super = env_->getAt(dist, 0).as<BetaClass>();
 
 	// the class instance is always one scope below super
-	BetaInstance::pointer_type obj = convert<BetaInstance>(env_->getAt(dist - 1, "me"));
+	BetaInstance::pointer_type obj = env_->getAt(dist - 1, 0).as<BetaInstance>();
 	// bind "me" to the superclass's method and then return it
 	CustomFunction::pointer_type method = super->findMethod(obj, expr->method_->getName());
 
@@ -320,7 +404,7 @@ Token::pointer_type Interpreter::visit(SuperExpression * expr)
 		throw InterpreterException(ss.str().c_str());
 	}
 
-	return tok_type(method);
+	return value_type(method);
 }
 
 /**
@@ -342,23 +426,24 @@ void Interpreter::visit(StmtExpression * expr)
 */
 void Interpreter::visit(StmtPrint * expr)
 {
-	tok_type val = evaluate(expr->expr_);
-	cout << val->toString() << endl;
+	value_type val = evaluate(expr->expr_);
+	cout << val.toString() << endl;
 }
 
 /**
 @name:		visit
-@purpose:	Evaluates a Return Statement and throws a Return Exception
+@purpose:	Evaluates a Return Statement and marks the statement as completed by a return
 @param:		StmtReturn *
 @return:	void
 */
 void Interpreter::visit(StmtReturn * expr)
 {
-	tok_type val = nullptr;
+	value_type val;
 	if (expr->expr_ != nullptr) 
 		val = evaluate(expr->expr_);
 
-	throw ReturnEx(val);
+	returnValue_ = val;
+	completion_ = Completion::RETURN;
 }
 
 /**
@@ -369,17 +454,17 @@ void Interpreter::visit(StmtReturn * expr)
 */
 void Interpreter::visit(StmtVariable * expr)
 {
-	tok_type tok;
+	value_type tok;
 	if (expr->expr_ != nullptr)
 	{
 		tok = evaluate(expr->expr_);
 		VarType type = expr->var_->getType();
 
-		if (!checkType(type, tok))
-			throw InterpreterException(string("InterpreterException: Cannot assign \"" + tok->toString() + "\" to a " + VarTypeName(type)).c_str());
+		if (!expr->checked_ && !checkType(type, tok))
+			throw InterpreterException(string("InterpreterException: Cannot assign \"" + tok.toString() + "\" to a " + VarTypeName(type)).c_str());
 	}
 		
-	env_->define(expr->var_->getName(), tok);
+	env_->define(expr->slot_, tok);
 }
 
 /**
@@ -390,7 +475,17 @@ void Interpreter::visit(StmtVariable * expr)
 */
 void Interpreter::visit(StmtBlock * expr)
 {
-	executeBlock(expr->statements_, env_);
+	// blocks that declare nothing run in the enclosing environment, as the resolver gave them no scope
+	if (expr->numSlots_ == 0)
+		executeBlock(expr->statements_, env_);
+	else if (expr->captured_)	// only a block a closure may outlive needs an environment on the heap
+		executeBlock(expr->statements_, Heap::get().make<Environment>(env_, expr->numSlots_));
+	else
+	{
+		size_t mark = frames_.mark();
+		executeBlock(expr->statements_, frames_.acquire(env_, expr->numSlots_));
+		frames_.release(mark);
+	}
 }
 
 /**
@@ -401,45 +496,45 @@ void Interpreter::visit(StmtBlock * expr)
 */
 void Interpreter::visit(StmtClass * expr)
 {
-	tok_type super = nullptr;
+	value_type super;
 	if (expr->super_ != nullptr)
 	{
 		super = evaluate(expr->super_);
-		if (!is<BetaClass>(super))
+		if (!super.isObject() || !is<BetaClass>(super.ref()))
 		{
 			stringstream ss;
-			ss << "InterpreterException: \"" << super->toString() << "\" is not a known class.";
+			ss << "InterpreterException: \"" << super.toString() << "\" is not a known class.";
 			throw InterpreterException(ss.str().c_str());
 		}
 	}
 
 	// defines the uninitialized class in memory
-	env_->define(expr->name_->getName(), nullptr);
+	env_->define(expr->slot_, value_type());
 
 	// super is just inside of the class's environment
 	if (expr->super_ != nullptr)
 	{
-		env_.reset(new Environment(env_));
-		env_->define("super", super);
+		env_ = Heap::get().make<Environment>(env_, 1);
+		env_->define(0, super);
 	}
 
 	// stores each method, and whether or not it is the init() method
 	map<string, CustomFunction::pointer_type> methods;
 	list<Variable::pointer_type> data;
 
-	for (auto datum : expr->data_)
+	for (auto const& datum : expr->data_)
 		data.push_back(datum);
 
-	for (auto method : expr->methods_)
-		methods.insert(pair<string, CustomFunction::pointer_type>(method->ident_->getName(), CustomFunction::pointer_type(new CustomFunction(method, env_, method->ident_->getName() == "init"))));
+	for (auto const& method : expr->methods_)
+		methods.insert(pair<string, CustomFunction::pointer_type>(method->ident_->getName(), Heap::get().make<CustomFunction>(method.get(), env_, true, method->ident_->getName() == "init")));
 
-	BetaClass::pointer_type cla(new BetaClass(expr->name_->getName(), convert<BetaClass>(super), data, methods));
+	BetaClass::pointer_type cla = Heap::get().make<BetaClass>(expr->name_->getName(), super.as<BetaClass>(), data, methods);
 
 	// reset the environment if there is no super class (all methods are below the super instance)
-	if (super != nullptr)
+	if (!super.isNil())
 		env_ = env_->parent_;
 
-	env_->reassign(expr->name_->getName(), cla);
+	env_->define(expr->slot_, value_type(cla));
 }
 
 /**
@@ -450,16 +545,15 @@ void Interpreter::visit(StmtClass * expr)
 */
 void Interpreter::visit(StmtIf * expr)
 {
-	tok_type eval = evaluate(expr->expr_);
-	if (is<Boolean>(eval))
+	value_type cond = evaluate(expr->expr_);
+	if (cond.isBool())
 	{
-		Boolean::pointer_type cond = convert<Boolean>(eval);
-		if (cond->getValue() == true)
+		if (cond.asBool() == true)
 			execute(expr->thenBlock_);
 		
 		// don't evaluate if there is no else block
 		if (expr->elseBlock_ != nullptr)
-			if (cond->getValue() == false)
+			if (cond.asBool() == false)
 				execute(expr->elseBlock_);
 
 		return;
@@ -476,14 +570,16 @@ void Interpreter::visit(StmtIf * expr)
 */
 void Interpreter::visit(StmtWhile * expr)
 {
-	tok_type cond = evaluate(expr->expr_);
-	while (is<Boolean>(cond) && convert<Boolean>(cond)->getValue() == true)
+	value_type cond = evaluate(expr->expr_);
+	while (cond.isBool() && cond.asBool() == true)
 	{
-		execute(expr->whileBlock_);
+		if (execute(expr->whileBlock_) == Completion::RETURN)
+			return;
+
 		cond = evaluate(expr->expr_);
 	}
 
-	if (!is<Boolean>(cond))
+	if (!cond.isBool())
 		throw InterpreterException("While-loop condition must evaluate to true or false.");
 }
 
@@ -495,15 +591,17 @@ void Interpreter::visit(StmtWhile * expr)
 */
 void Interpreter::visit(StmtDoWhile * expr)
 {
-	tok_type cond;
+	value_type cond;
 	do
 	{
-		execute(expr->whileBlock_);
+		if (execute(expr->whileBlock_) == Completion::RETURN)
+			return;
+
 		cond = evaluate(expr->expr_);
 	} 
-	while (is<Boolean>(cond) && convert<Boolean>(cond)->getValue() == true);
+	while (cond.isBool() && cond.asBool() == true);
 
-	if (!is<Boolean>(cond))
+	if (!cond.isBool())
 		throw InterpreterException("Do-While loop condition must evaluate to true or false.");
 }
 
@@ -515,8 +613,8 @@ void Interpreter::visit(StmtDoWhile * expr)
 */
 void Interpreter::visit(StmtFunc * expr)
 {
-	CustomFunction::pointer_type func(new CustomFunction(shared_ptr<StmtFunc>(expr), env_, false));
-	env_->define(expr->ident_->toString(), tok_type(func));
+	CustomFunction::pointer_type func = Heap::get().make<CustomFunction>(expr, env_, false, false);
+	env_->define(expr->slot_, value_type(func));
 }
 
 /**
@@ -527,65 +625,63 @@ void Interpreter::visit(StmtFunc * expr)
 */
 void Interpreter::prepareNativeFunctions()
 {
-	globals_->define("abs", make<Abs>());
-	globals_->define("mod", make<Modulus>());
-	globals_->define("cos", make<Cos>());
-	globals_->define("exp", make<Expo>());
-	globals_->define("log", make<Log>());
-	globals_->define("sin", make<Sin>());
-	globals_->define("sqr", make<Sqr>());
-	globals_->define("tan", make<Tan>());
-	globals_->define("datetime", make<DateTime>());
-	globals_->define("datetimeUTC", make<DateTimeUTC>());
-	globals_->define("epoch", make<Epoch>());
+	defineNative("abs", value_type(make<Abs>()));
+	defineNative("mod", value_type(make<Modulus>()));
+	defineNative("cos", value_type(make<Cos>()));
+	defineNative("exp", value_type(make<Expo>()));
+	defineNative("log", value_type(make<Log>()));
+	defineNative("sin", value_type(make<Sin>()));
+	defineNative("sqr", value_type(make<Sqr>()));
+	defineNative("tan", value_type(make<Tan>()));
+	defineNative("datetime", value_type(make<DateTime>()));
+	defineNative("datetimeUTC", value_type(make<DateTimeUTC>()));
+	defineNative("epoch", value_type(make<Epoch>()));
 }
 
 /**
-@name:		evaluate
-@purpose:	Calls the Expression's accept method
-@param:		Interpreter::expr_type
-@return:	Interpreter::tok_type
+@name:		defineNative
+@purpose:	Stores a native function in the next global slot, and records its name for the resolver
+@param:		std::string, Interpreter::value_type
+@return:	void
 */
-Interpreter::tok_type Interpreter::evaluate(Interpreter::expr_type expr)
+void Interpreter::defineNative(std::string name, value_type func)
 {
-	return expr->accept(*this);
+	globals_->define(static_cast<unsigned>(nativeNames_.size()), func);
+	nativeNames_.push_back(name);
 }
 
 /**
-@name:		execute
-@purpose:	Calls the Statement's accept method
-@param:		Interpreter::stmt_p
-@return:	void
+@name:		evaluate
+@purpose:	Calls the Expression's accept method
+@param:		Interpreter::expr_type const &
+@return:	Interpreter::value_type
 */
-void Interpreter::execute(stmt_p stmt)
+Interpreter::value_type Interpreter::evaluate(Interpreter::expr_type const& expr)
 {
-	stmt->accept(*this);
+	return expr->accept(*this);
 }
 
 /**
-@name:		lookUpVariable
-@purpose:	Finds a variable in a higher scope, or in the global scope
-@param:		std::string, Expression *
-@return:	Token::pointer_type
+@name:		execute
+@purpose:	Calls the Statement's accept method, and returns how the statement completed
+@param:		Interpreter::stmt_p const &
+@return:	Completion
 */
-Token::pointer_type Interpreter::lookUpVariable(std::string name, Expression * expr)
+Completion Interpreter::execute(stmt_p const& stmt)
 {
-	auto itVar = locals_.find(expr);
-	if (itVar != locals_.end())
-		return env_->getAt(itVar->second, name);
-	
-	return globals_->get(name);
+	stmt->accept(*this);
+	return completion_;
 }
 
 /**
 @name:		interpret
 @purpose:	Evaluates every statement in the program
-@param:		Interpreter::stmt_list
+@param:		Interpreter::stmt_list const &
 @return:	void
 */
-void Interpreter::interpret(stmt_list lstState)
+void Interpreter::interpret(stmt_list const& lstState)
 {
-	for (auto state : lstState)
+	for (auto const& state : lstState)
 	{
 		execute(state);
 		++PositionTracker::itStmtPos_;
@@ -594,29 +690,21 @@ void Interpreter::interpret(stmt_list lstState)
 
 /**
 @name:		executeBlock
-@purpose:	Exectutes a block of statements, std::shared_ptr<Environment>
-@param:		Interpreter::stmt_list
-@return:	void
+@purpose:	Exectutes a block of statements, stopping early at a return
+@param:		Interpreter::stmt_list const &, Environment::pointer_type
+@return:	Completion
 */
-void Interpreter::executeBlock(stmt_list statements, std::shared_ptr<Environment> env)
+Completion Interpreter::executeBlock(stmt_list const& statements, Environment::pointer_type env)
 {
 	// reset the environment, as this may be a function or a method
-	std::shared_ptr<Environment> prev = env_;
-	env_ = env;
+	Environment::pointer_type prev = std::move(env_);
+	env_ = std::move(env);
 
-	for (auto state : statements)
-		execute(state);
+	Completion completion = Completion::NORMAL;
+	for (auto const& state : statements)
+		if ((completion = execute(state)) == Completion::RETURN)
+			break;
 
-	env_ = prev;
-}
-
-/**
-@name:		resolve
-@purpose:	Inserts an expression tied to a variable, and how many scopes the variable declaration is above said expression
-@param:		Expression *, unsigned
-@return:	void
-*/
-void Interpreter::resolve(Expression * expr, unsigned depth)
-{
-	locals_.insert(pair<Expression*, unsigned>(expr, depth));
-}
+	env_ = std::move(prev);
+	return completion;
+}
\ No newline at end of file
@@ -11,6 +11,13 @@
 #include "environment.hpp"
 #include <list>
 #include <map>
+#include <string>
+#include <vector>
+
+class BetaInstance;
+
+// how a statement finished, a return skips the rest of every enclosing block and loop up to its function call
+enum class Completion { NORMAL, RETURN };
 
 class Interpreter : public ExprVisitor, public StmtVisitor
 {
@@ -23,28 +30,33 @@ public:
 public:
 	using oper_type = Operand::pointer_type;
 	using tok_type = Token::pointer_type;
+	using value_type = Value;
 	using expr_type = Expression::expr_type;
 	using stmt_p = Statement::pointer_type;
 	using stmt_list = std::list<stmt_p>;
 private:
-	std::shared_ptr<Environment> env_;
-	std::shared_ptr<Environment> globals_;
-	std::map<Expression *, unsigned> locals_;
+	FramePool frames_;						// environments of the blocks and calls in progress that nothing captures, outlives the handles below
+	Environment::pointer_type env_;
+	Environment::pointer_type globals_;
+	std::vector<std::string> nativeNames_;	// names of the native functions, in the order of their global slots
+	Completion completion_;					// set by a return statement, cleared by the function call that consumes it
+	value_type returnValue_;
+	std::vector<value_type> argStack_;		// arguments of the calls in progress
 public:
 	Interpreter();
 
-	virtual Token::pointer_type visit(AssignExpression * expr) override;
-	virtual Token::pointer_type visit(BinaryExpression * expr) override;
-	virtual Token::pointer_type visit(CallExpression * expr) override;
-	virtual Token::pointer_type visit(UnaryExpression * expr) override;
-	virtual Token::pointer_type visit(GroupExpression * expr) override;
-	virtual Token::pointer_type visit(LiteralExpression * expr) override;
-	virtual Token::pointer_type visit(VariableExpression * expr) override;
-	virtual Token::pointer_type visit(LogicalExpression * expr) override;
-	virtual Token::pointer_type visit(GetExpression * expr) override;
-	virtual Token::pointer_type visit(SetExpression * expr) override;
-	virtual Token::pointer_type visit(MeExpression * expr) override;
-	virtual Token::pointer_type visit(SuperExpression * expr) override;
+	virtual Value visit(AssignExpression * expr) override;
+	virtual Value visit(BinaryExpression * expr) override;
+	virtual Value visit(CallExpression * expr) override;
+	virtual Value visit(UnaryExpression * expr) override;
+	virtual Value visit(GroupExpression * expr) override;
+	virtual Value visit(LiteralExpression * expr) override;
+	virtual Value visit(VariableExpression * expr) override;
+	virtual Value visit(LogicalExpression * expr) override;
+	virtual Value visit(GetExpression * expr) override;
+	virtual Value visit(SetExpression * expr) override;
+	virtual Value visit(MeExpression * expr) override;
+	virtual Value visit(SuperExpression * expr) override;
 	
 	virtual void visit(StmtExpression * expr) override;
 	virtual void visit(StmtPrint * expr) override;
@@ -57,18 +69,21 @@ public:
 	virtual void visit(StmtDoWhile * expr) override;
 	virtual void visit(StmtFunc * expr) override;
 	
-	void interpret(stmt_list lstState);
-	void executeBlock(stmt_list statements, std::shared_ptr<Environment> env);
-	void resolve(Expression * expr, unsigned depth);
+	void interpret(stmt_list const& lstState);
+	Completion executeBlock(stmt_list const& statements, Environment::pointer_type env);
+	Environment::pointer_type globals() const { return globals_; }
+
+	static std::string VarTypeName(VarType type);
+	static bool checkType(VarType type, value_type const& val);
 
 private:
 	void prepareNativeFunctions();
-	tok_type evaluate(expr_type expr);
-	void execute(stmt_p stmt);
-	Token::pointer_type lookUpVariable(std::string name, Expression * expr);
-	std::string VarTypeName(VarType type);
-	bool checkType(VarType type, Token::pointer_type val);
+	void defineNative(std::string name, value_type func);
+	value_type evaluate(expr_type const& expr);
+	Completion execute(stmt_p const& stmt);
+	Ref<BetaInstance> instanceOf(value_type const& obj, Variable::pointer_type const& name);
 
 	friend class CustomFunction;
 	friend class Resolver;
+	friend class TypeChecker;
 };
\ No newline at end of file
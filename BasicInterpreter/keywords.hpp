@@ -14,6 +14,7 @@ class Keyword : public Token
 public:
 	DEF_POINTER_TYPE(Keyword)
 	DEF_IS_CONVERTIBLE_FROM(Keyword)
+	Keyword() { kind_ = first_kind; }
 };
 
 class Var : public Keyword
@@ -21,6 +22,7 @@ class Var : public Keyword
 public:
 	DEF_POINTER_TYPE(Var)
 	DEF_IS_CONVERTIBLE_FROM(Var)
+	Var() { kind_ = first_kind; }
 };
 
 	class VarBool : public Var
@@ -28,6 +30,7 @@ public:
 	public:
 		DEF_POINTER_TYPE(VarBool)
 		DEF_IS_CONVERTIBLE_FROM(VarBool)
+		VarBool() { kind_ = first_kind; }
 	};
 
 	class VarNumber : public Var
@@ -35,6 +38,7 @@ public:
 	public:
 		DEF_POINTER_TYPE(VarNumber)
 		DEF_IS_CONVERTIBLE_FROM(VarNumber)
+		VarNumber() { kind_ = first_kind; }
 	};
 
 		class VarInt : public VarNumber
@@ -42,6 +46,7 @@ public:
 		public:
 			DEF_POINTER_TYPE(VarInt)
 			DEF_IS_CONVERTIBLE_FROM(VarInt)
+			VarInt() { kind_ = first_kind; }
 		};
 
 		class VarFloat : public VarNumber
@@ -49,6 +54,7 @@ public:
 		public:
 			DEF_POINTER_TYPE(VarFloat)
 			DEF_IS_CONVERTIBLE_FROM(VarFloat)
+			VarFloat() { kind_ = first_kind; }
 		};
 
 	class VarWord : public Var
@@ -56,6 +62,7 @@ public:
 	public:
 		DEF_POINTER_TYPE(VarWord)
 		DEF_IS_CONVERTIBLE_FROM(VarWord)
+		VarWord() { kind_ = first_kind; }
 	};
 
 	class VarObject : public Var
@@ -63,6 +70,7 @@ public:
 	public:
 		DEF_POINTER_TYPE(VarObject)
 		DEF_IS_CONVERTIBLE_FROM(VarObject)
+		VarObject() { kind_ = first_kind; }
 	};
 
 	class VarVoid : public Var
@@ -70,41 +78,49 @@ public:
 	public:
 		DEF_POINTER_TYPE(VarVoid)
 		DEF_IS_CONVERTIBLE_FROM(VarVoid)
+		VarVoid() { kind_ = first_kind; }
 	};
 
 class Print : public Keyword
 {
 	DEF_IS_CONVERTIBLE_FROM(Print)
+	Print() { kind_ = first_kind; }
 };
 
 class If : public Keyword
 {
 	DEF_IS_CONVERTIBLE_FROM(If)
+	If() { kind_ = first_kind; }
 };
 
 class Else : public Keyword
 {
 	DEF_IS_CONVERTIBLE_FROM(Else)
+	Else() { kind_ = first_kind; }
 };
 
 class While : public Keyword
 {
 	DEF_IS_CONVERTIBLE_FROM(While)
+	While() { kind_ = first_kind; }
 };
 
 class For : public Keyword
 {
 	DEF_IS_CONVERTIBLE_FROM(For)
+	For() { kind_ = first_kind; }
 };
 
 class Do : public Keyword
 {
 	DEF_IS_CONVERTIBLE_FROM(Do)
+	Do() { kind_ = first_kind; }
 };
 
 class Func : public Keyword
 {
 	DEF_IS_CONVERTIBLE_FROM(Func)
+	Func() { kind_ = first_kind; }
 };
 
 class Return : public Keyword
@@ -112,6 +128,7 @@ class Return : public Keyword
 public:
 	DEF_POINTER_TYPE(Return)
 	DEF_IS_CONVERTIBLE_FROM(Return)
+	Return() { kind_ = first_kind; }
 };
 
 class Class : public Keyword
@@ -119,6 +136,7 @@ class Class : public Keyword
 public:
 	DEF_POINTER_TYPE(Class)
 	DEF_IS_CONVERTIBLE_FROM(Class)
+	Class() { kind_ = first_kind; }
 };
 
 class Me : public Keyword
@@ -126,6 +144,7 @@ class Me : public Keyword
 public:
 	DEF_POINTER_TYPE(Me)
 	DEF_IS_CONVERTIBLE_FROM(Me)
+	Me() { kind_ = first_kind; }
 };
 
 class Inherits : public Keyword
@@ -133,6 +152,7 @@ class Inherits : public Keyword
 public:
 	DEF_POINTER_TYPE(Inherits)
 	DEF_IS_CONVERTIBLE_FROM(Inherits)
+	Inherits() { kind_ = first_kind; }
 };
 
 class Super : public Keyword
@@ -140,6 +160,7 @@ class Super : public Keyword
 public:
 	DEF_POINTER_TYPE(Super)
 	DEF_IS_CONVERTIBLE_FROM(Super)
+	Super() { kind_ = first_kind; }
 };
 
 class Data : public Keyword
@@ -147,6 +168,7 @@ class Data : public Keyword
 public:
 	DEF_POINTER_TYPE(Data)
 	DEF_IS_CONVERTIBLE_FROM(Data)
+	Data() { kind_ = first_kind; }
 };
 
 class Method : public Keyword
@@ -154,4 +176,5 @@ class Method : public Keyword
 public:
 	DEF_POINTER_TYPE(Method)
 	DEF_IS_CONVERTIBLE_FROM(Method)
+	Method() { kind_ = first_kind; }
 };
\ No newline at end of file
@@ -30,10 +30,10 @@ using namespace std;
 /**
 @name:		Lexer
 @purpose:	defines a series of keywords, constants, and operators
-@param:		null
+@param:		AstArena &
 @return:	Lexer
 */
-Lexer::Lexer()
+Lexer::Lexer(AstArena& arena) : arena_(arena)
 {
 	// keywords
 	specialTokens_["shout"] = make<Print>();
@@ -449,9 +449,9 @@ Token::pointer_type Lexer::getIdentifier(Lexer::string_type::const_iterator & cu
 */
 Token::pointer_type Lexer::getNumber(Lexer::string_type::const_iterator & curChar, Lexer::string_type const & expression)
 {
-	using float_type = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<1000, int32_t, void>>;
 	using int_type = boost::multiprecision::cpp_int;
 
+	auto numStart = curChar;
 	auto currentCharNum = curChar;
 	int_type acc = boost::lexical_cast<int_type>(*currentCharNum);
 	++curChar;
@@ -475,33 +475,16 @@ Token::pointer_type Lexer::getNumber(Lexer::string_type::const_iterator & curCha
 
 	if (*curChar == '.')
 	{
-		float_type accR = boost::lexical_cast<float_type>(acc);
-		int_type div = 1;
-		int_type base = 10;
 		++curChar;
+		while (curChar != expression.cend() && isdigit(*curChar))
+			++curChar;
 
-		if (curChar != expression.cend())
-		{
-			while (isdigit(*curChar))
-			{
-				currentCharNum = curChar;
-				int_type power = 1;
-
-				for (int_type i = 0; i < div; ++i)
-					power *= base;
+		// convert the whole literal at once so it is rounded a single time at the selected precision
+		string_type text(numStart, curChar);
+		if (text.back() == '.')
+			text += '0';
 
-				accR += boost::lexical_cast<float_type>(*currentCharNum) / boost::lexical_cast<float_type>(power);
-				++div;
-				++curChar;
-				if (curChar == expression.cend())
-					break;
-			}
-			return make<Float>(accR);
-		}
-		else
-		{
-			return make<Float>(accR);
-		}
+		return make<Float>(Float::parse(text));
 	}
 
 	return make<Integer>(acc);
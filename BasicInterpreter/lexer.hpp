@@ -11,6 +11,7 @@
 #include "token.hpp"
 #include "variable.hpp"
 #include "operand.hpp"
+#include "ast_arena.hpp"
 #include <map>
 #include <string>
 
@@ -40,14 +41,33 @@ public:
 private:
 	using dictionary_type = std::map<string_type, Token::pointer_type>;
 
+	AstArena& arena_;
 	dictionary_type specialTokens_;
 	dictionary_type variables_;
 
 public:
-	Lexer();
+	Lexer() = delete;
+	Lexer(AstArena& arena);
 	TokenList analyze(string_type const& expression);
 
 private:
+	template <typename T, typename... Args> Token::pointer_type make(Args&&... args);
+
 	Token::pointer_type getIdentifier(Lexer::string_type::const_iterator& curChar, Lexer::string_type const& expression);
 	Token::pointer_type getNumber(Lexer::string_type::const_iterator& curChar, Lexer::string_type const& expression);
-};
\ No newline at end of file
+};
+
+/**
+@name:		make
+@purpose:	creates a token in the program's arena
+@param:		Args&&...
+@return:	Token::pointer_type
+*/
+template <typename T, typename... Args> 
+Token::pointer_type Lexer::make(Args&&... args)
+{
+	Token::pointer_type newTok = arena_.make<T>(std::forward<Args>(args)...);
+	newTok->setLineNumber(1);
+	newTok->setIndentNumber(1);
+	return newTok;
+}
\ No newline at end of file
@@ -2,27 +2,68 @@
 #include "lexer.hpp"
 #include "parser.hpp"
 #include "resolver.hpp"
+#include "type_checker.hpp"
+#include "constant_folder.hpp"
 #include "interpreter.hpp"
 #include "position_tracker.hpp"
+#include "entry.hpp"
+#include <cstring>
+#include <fstream>
+#include <sstream>
 
 using namespace std;
 
-int main()
+/**
+@name:		engineNamed
+@purpose:	returns the engine a command line names, the tree walker if it names none
+@param:		char const *
+@return:	Engine
+*/
+static Engine engineNamed(char const* name)
 {
+	if (strcmp(name, "bytecode") == 0)
+		return Engine::BYTECODE;
+	if (strcmp(name, "closure") == 0)
+		return Engine::CLOSURE;
+	if (strcmp(name, "register") == 0)
+		return Engine::REGISTER;
+	return Engine::TREE;
+}
+
+// with no arguments, runs the debugging snippet below; otherwise runs a file: BasicInterpreter <file> [tree|bytecode|closure|register]
+int main(int argc, char* argv[])
+{
+	if (argc > 1)
+	{
+		ifstream file(argv[1]);
+		if (!file)
+		{
+			cerr << "Cannot open " << argv[1] << endl;
+			return 1;
+		}
+
+		stringstream text;
+		text << file.rdbuf();
+		Entry::interpret(text.str(), argc > 2 ? engineNamed(argv[2]) : Engine::TREE);
+		return 0;
+	}
+
+	AstArena arena;
+
 	try
 	{
 		PositionTracker::rawCode_ = "float x = abs(-1); word y = x;";
 		PositionTracker::cursorPosition_ = 0;
 		PositionTracker::stage_ = Stage::RAW;
 		
-		Lexer lex;
+		Lexer lex(arena);
 		TokenList list = lex.analyze(PositionTracker::rawCode_);
 
 		PositionTracker::stage_ = Stage::LEXED;
 		PositionTracker::itTokPos_ = PositionTracker::tokenPosition_.cbegin();
 		PositionTracker::cursorPosition_ = 0;
 		
-		Parser parse(list);
+		Parser parse(list, arena);
 		Parser::stmt_list stmts = parse.parse();
 
 		PositionTracker::itStmtPos_ = PositionTracker::stmtPosition_.cbegin();
@@ -33,6 +74,15 @@ int main()
 		resolver.resolve(stmts);
 
 		PositionTracker::itStmtPos_ = PositionTracker::stmtPosition_.cbegin();
+
+		TypeChecker checker(&interpreter);
+		checker.check(stmts);
+
+		PositionTracker::itStmtPos_ = PositionTracker::stmtPosition_.cbegin();
+
+		// after the checks, so code that never runs is still checked
+		ConstantFolder folder(arena);
+		folder.fold(stmts);
 		
 		interpreter.interpret(stmts);
 	}
@@ -41,4 +91,7 @@ int main()
 		cerr << ex.what() << endl;
 		cerr << PositionTracker::printPosition() << endl;
 	}
+
+	// the tracker's handles point into the arena
+	PositionTracker::clear();
 }
\ No newline at end of file
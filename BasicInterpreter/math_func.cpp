@@ -17,34 +17,34 @@
 /**
 @name:		call
 @purpose:	Returns the first argument to the power of the second
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Pow::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Pow::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 	auto pow = args.back();
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
 		Float::value_type numVal;
 		Float::value_type powVal;
 		
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = static_cast<Float::value_type>(getValue<Float>(num));
+			numVal = static_cast<Float::value_type>(num.toFloat());
 
-		if (is<Integer>(pow) || is<Float>(pow))
+		if (pow.isInt() || pow.isFloat())
 		{
-			if (is<Integer>(pow))
-				powVal = static_cast<Float::value_type>(getValue<Integer>(pow));
+			if (pow.isInt())
+				powVal = static_cast<Float::value_type>(pow.toInteger());
 			else
-				powVal = static_cast<Float::value_type>(getValue<Float>(pow));
+				powVal = static_cast<Float::value_type>(pow.toFloat());
 			
-			return tok_p(float_p(new Float(boost::multiprecision::pow(numVal, powVal))));
+			return Value(Float::value_type(float_math::pow(numVal, powVal)));
 		}
-		else if (is<Boolean>(pow))
+		else if (pow.isBool())
 		{
 			throw FuncException("Pow()", "Boolean");
 		}
@@ -53,7 +53,7 @@ Token::pointer_type Pow::call(Interpreter * interpreter, std::list<Token::pointe
 			throw FuncException("Pow()", "Word");
 		}
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Pow()", "Boolean");
 	}
@@ -66,25 +66,25 @@ Token::pointer_type Pow::call(Interpreter * interpreter, std::list<Token::pointe
 /**
 @name:		call
 @purpose:	Returns the tangent of a single argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Tan::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Tan::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
 	Float::value_type numVal;
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = getValue<Float>(num);
+			numVal = num.toFloat();
 
-		return tok_p(float_p(new Float(boost::multiprecision::tan(numVal))));
+		return Value(Float::value_type(float_math::tan(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Tan()", "Boolean");
 	}
@@ -97,25 +97,25 @@ Token::pointer_type Tan::call(Interpreter * interpreter, std::list<Token::pointe
 /**
 @name:		call
 @purpose:	Returns the square root of a single argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Sqr::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Sqr::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
 	Float::value_type numVal;
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = getValue<Float>(num);
+			numVal = num.toFloat();
 
-		return tok_p(float_p(new Float(boost::multiprecision::sqrt(numVal))));
+		return Value(Float::value_type(float_math::sqrt(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Sqr()", "Boolean");
 	}
@@ -128,25 +128,25 @@ Token::pointer_type Sqr::call(Interpreter * interpreter, std::list<Token::pointe
 /**
 @name:		call
 @purpose:	Returns the sine of a single argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Sin::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Sin::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
 	Float::value_type numVal;
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = getValue<Float>(num);
+			numVal = num.toFloat();
 
-		return tok_p(float_p(new Float(boost::multiprecision::sin(numVal))));
+		return Value(Float::value_type(float_math::sin(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Sin()", "Boolean");
 	}
@@ -159,32 +159,32 @@ Token::pointer_type Sin::call(Interpreter * interpreter, std::list<Token::pointe
 /**
 @name:		call
 @purpose:	Returns a random number between two arguments
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Rnd::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Rnd::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto beg = args.front();
 	auto end = args.back();
 	boost::random::mt19937 rnd;
 
-	if (is<Integer>(beg))
+	if (beg.isInt())
 	{
-		auto begVal = getValue<Integer>(beg);
+		auto begVal = beg.toInteger();
 
-		if (is<Integer>(end))
+		if (end.isInt())
 		{
-			auto endVal = getValue<Integer>(end);
+			auto endVal = end.toInteger();
 			boost::random::uniform_int_distribution<Integer::value_type> gen(begVal, endVal);
-			return tok_p(int_p(new Integer(static_cast<Integer::value_type>((gen(rnd))))));
+			return Value(static_cast<Integer::value_type>(gen(rnd)));
 		}
-		else if (is<Float>(end))
+		else if (end.isFloat())
 		{
-			auto endVal = getValue<Float>(end);
+			auto endVal = end.toFloat();
 			boost::random::uniform_real_distribution<Float::value_type> gen(static_cast<Float::value_type>(begVal), endVal);
-			return tok_p(float_p(new Float(Float::value_type(gen(rnd)))));
+			return Value(Float::value_type(gen(rnd)));
 		}
-		else if (is<Boolean>(end))
+		else if (end.isBool())
 		{
 			throw FuncException("Rnd()", "Boolean");
 		}
@@ -193,22 +193,22 @@ Token::pointer_type Rnd::call(Interpreter * interpreter, std::list<Token::pointe
 			throw FuncException("Rnd()", "Word");
 		}
 	}
-	else if (is<Float>(beg))
+	else if (beg.isFloat())
 	{
-		auto begVal = getValue<Float>(beg);
+		auto begVal = beg.toFloat();
 		Float::value_type endVal;
 
-		if (is<Integer>(end))
-			endVal = static_cast<Float::value_type>(getValue<Integer>(end));
+		if (end.isInt())
+			endVal = static_cast<Float::value_type>(end.toInteger());
 		else
-			endVal = getValue<Float>(end);
+			endVal = end.toFloat();
 
-		if (is<Integer>(end) || is<Float>(end))
+		if (end.isInt() || end.isFloat())
 		{
 			boost::random::uniform_real_distribution<Float::value_type> gen(begVal, endVal);
-			return tok_p(int_p(new Integer(static_cast<Integer::value_type>(gen(rnd)))));
+			return Value(static_cast<Integer::value_type>(gen(rnd)));
 		}
-		else if (is<Boolean>(end))
+		else if (end.isBool())
 		{
 			throw FuncException("Rnd()", "Boolean");
 		}
@@ -217,7 +217,7 @@ Token::pointer_type Rnd::call(Interpreter * interpreter, std::list<Token::pointe
 			throw FuncException("Rnd()", "Word");
 		}
 	}
-	else if (is<Boolean>(beg))
+	else if (beg.isBool())
 	{
 		throw FuncException("Rnd()", "Boolean");
 	}
@@ -230,25 +230,25 @@ Token::pointer_type Rnd::call(Interpreter * interpreter, std::list<Token::pointe
 /**
 @name:		call
 @purpose:	Returns the log of a single argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Log::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Log::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
 	Float::value_type numVal;
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = getValue<Float>(num);
+			numVal = num.toFloat();
 
-		return tok_p(float_p(new Float(boost::multiprecision::log10(numVal))));
+		return Value(Float::value_type(float_math::log10(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Log()", "Boolean");
 	}
@@ -261,25 +261,25 @@ Token::pointer_type Log::call(Interpreter * interpreter, std::list<Token::pointe
 /**
 @name:		call
 @purpose:	Performs an exponential function on one argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Expo::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Expo::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
 	Float::value_type numVal;
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = getValue<Float>(num);
+			numVal = num.toFloat();
 
-		return tok_p(float_p(new Float(boost::multiprecision::exp(numVal))));
+		return Value(Float::value_type(float_math::exp(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Expo()", "Boolean");
 	}
@@ -292,25 +292,25 @@ Token::pointer_type Expo::call(Interpreter * interpreter, std::list<Token::point
 /**
 @name:		call
 @purpose:	Returns the cosine of a single argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Cos::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Cos::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
 	Float::value_type numVal;
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = getValue<Float>(num);
+			numVal = num.toFloat();
 
-		return tok_p(float_p(new Float(boost::multiprecision::cos(numVal))));
+		return Value(Float::value_type(float_math::cos(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Cos()", "Boolean");
 	}
@@ -324,25 +324,25 @@ Token::pointer_type Cos::call(Interpreter * interpreter, std::list<Token::pointe
 /**
 @name:		call
 @purpose:	Returns the arctangent of a single argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Arctan::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Arctan::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
 	Float::value_type numVal;
 
-	if (is<Integer>(num) || is<Float>(num))
+	if (num.isInt() || num.isFloat())
 	{
-		if (is<Integer>(num))
-			numVal = static_cast<Float::value_type>(getValue<Integer>(num));
+		if (num.isInt())
+			numVal = static_cast<Float::value_type>(num.toInteger());
 		else
-			numVal = getValue<Float>(num);
+			numVal = num.toFloat();
 
-		return tok_p(float_p(new Float(boost::multiprecision::atan(numVal))));
+		return Value(Float::value_type(float_math::atan(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Arctan()", "Boolean");
 	}
@@ -355,24 +355,24 @@ Token::pointer_type Arctan::call(Interpreter * interpreter, std::list<Token::poi
 /**
 @name:		call
 @purpose:	Returns the absolute value of a single argument
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Abs::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Abs::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto num = args.front();
 
-	if (is<Integer>(num))
+	if (num.isInt())
 	{
-		auto numVal = getValue<Integer>(num);
-		return tok_p(int_p(new Integer(static_cast<Integer::value_type>(boost::multiprecision::abs(numVal)))));
+		auto numVal = num.toInteger();
+		return Value(static_cast<Integer::value_type>(boost::multiprecision::abs(numVal)));
 	}
-	else if (is<Float>(num))
+	else if (num.isFloat())
 	{
-		auto numVal = getValue<Float>(num);
-		return tok_p(float_p(new Float(boost::multiprecision::abs(numVal))));
+		auto numVal = num.toFloat();
+		return Value(Float::value_type(float_math::abs(numVal)));
 	}
-	else if (is<Boolean>(num))
+	else if (num.isBool())
 	{
 		throw FuncException("Abs()", "Boolean");
 	}
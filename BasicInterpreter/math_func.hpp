@@ -15,9 +15,10 @@ class Abs : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Abs)
 	DEF_IS_CONVERTIBLE_FROM(Abs)
+	Abs() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Absolute>"; }
 };
 
@@ -26,9 +27,10 @@ class Arctan : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Arctan)
 	DEF_IS_CONVERTIBLE_FROM(Arctan)
+	Arctan() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Arctangent>"; }
 };
 
@@ -37,9 +39,10 @@ class Cos : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Cos)
 	DEF_IS_CONVERTIBLE_FROM(Cos)
+	Cos() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Cosine>"; }
 };
 
@@ -48,9 +51,10 @@ class Expo : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Expo)
 	DEF_IS_CONVERTIBLE_FROM(Expo)
+	Expo() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Exponent>"; }
 };
 
@@ -59,9 +63,10 @@ class Log : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Log)
 	DEF_IS_CONVERTIBLE_FROM(Log)
+	Log() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Natural Logarithm>"; }
 };
 
@@ -70,9 +75,10 @@ class Rnd : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Rnd)
 	DEF_IS_CONVERTIBLE_FROM(Rnd)
+	Rnd() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 2; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Random>"; }
 };
 
@@ -81,9 +87,10 @@ class Sin : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Sin)
 	DEF_IS_CONVERTIBLE_FROM(Sin)
+	Sin() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Sine>"; }
 };
 
@@ -92,9 +99,10 @@ class Sqr : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Sqr)
 	DEF_IS_CONVERTIBLE_FROM(Sqr)
+	Sqr() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Square Root>"; }
 };
 
@@ -103,9 +111,10 @@ class Tan : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Tan)
 	DEF_IS_CONVERTIBLE_FROM(Tan)
+	Tan() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 1; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Tangent>"; }
 };
 
@@ -114,8 +123,9 @@ class Pow : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Pow)
 	DEF_IS_CONVERTIBLE_FROM(Pow)
+	Pow() { kind_ = first_kind; }
 
 	virtual unsigned short arity() override { return 2; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args) override;
+	virtual Value call(Interpreter * interpreter, ArgSpan args) override;
 	virtual string_type toString() { return "<func | native | Power>"; }
 };
\ No newline at end of file
@@ -14,26 +14,26 @@ using namespace std;
 /**
 @name:		call
 @purpose:	Returns the current date and time as a word
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type DateTime::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value DateTime::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto tp = chrono::system_clock::now();
 
 	time_t now = chrono::system_clock::to_time_t(tp);
 	string sTime = ctime(&now);
 
-	return tok_p(make<Word>(sTime));
+	return Value(sTime);
 }
 
 /**
 @name:		call
 @purpose:	Returns the current UTC date and time as a word
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type DateTimeUTC::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value DateTimeUTC::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto tp = chrono::system_clock::now();
 
@@ -41,21 +41,21 @@ Token::pointer_type DateTimeUTC::call(Interpreter * interpreter, std::list<Token
 	auto utc = gmtime(&now);
 	string sTime = asctime(utc);
 
-	return tok_p(make<Word>(sTime));
+	return Value(sTime);
 }
 
 /**
 @name:		call
 @purpose:	Returns the number of second since the Epoch as an Integer
-@param:		Interpreter *, std::list<Token::pointer_type>
-@return:	Token::pointer_type
+@param:		Interpreter *, ArgSpan
+@return:	Value
 */
-Token::pointer_type Epoch::call(Interpreter * interpreter, std::list<Token::pointer_type> args)
+Value Epoch::call(Interpreter * interpreter, ArgSpan args)
 {
 	auto tp = chrono::system_clock::now();
 
 	auto epoch = chrono::duration_cast<chrono::seconds>(tp.time_since_epoch()).count();
 	auto seconds = static_cast<Integer::value_type>(epoch);
 
-	return tok_p(make<Integer>(seconds));
+	return Value(seconds);
 }
@@ -14,9 +14,10 @@ class DateTime : public BetaCallable
 public:
 	DEF_POINTER_TYPE(DateTime)
 	DEF_IS_CONVERTIBLE_FROM(DateTime)
+	DateTime() { kind_ = first_kind; }
 
 	virtual unsigned short arity() { return 0; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args);
+	virtual Value call(Interpreter * interpreter, ArgSpan args);
 	virtual string_type toString() { return "<func | native | DateTime>"; }
 };
 
@@ -25,9 +26,10 @@ class DateTimeUTC : public BetaCallable
 public:
 	DEF_POINTER_TYPE(DateTimeUTC)
 	DEF_IS_CONVERTIBLE_FROM(DateTimeUTC)
+	DateTimeUTC() { kind_ = first_kind; }
 
 	virtual unsigned short arity() { return 0; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args);
+	virtual Value call(Interpreter * interpreter, ArgSpan args);
 	virtual string_type toString() { return "<func | native | DateTimeUTC>"; }
 };
 
@@ -36,8 +38,9 @@ class Epoch : public BetaCallable
 public:
 	DEF_POINTER_TYPE(Epoch)
 	DEF_IS_CONVERTIBLE_FROM(Epoch)
+	Epoch() { kind_ = first_kind; }
 
 	virtual unsigned short arity() { return 0; }
-	virtual Token::pointer_type call(Interpreter * interpreter, std::list<Token::pointer_type> args);
+	virtual Value call(Interpreter * interpreter, ArgSpan args);
 	virtual string_type toString() { return "<func | native | Epoch>"; }
 };
\ No newline at end of file
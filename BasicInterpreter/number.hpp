@@ -12,4 +12,5 @@
 class Number : public Operand
 {
 	DEF_POINTER_TYPE(Number)
+	DEF_IS_CONVERTIBLE_FROM(Number)
 };
\ No newline at end of file
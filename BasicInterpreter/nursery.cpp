@@ -0,0 +1,145 @@
+/**	@file nursery.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of Nursery
+*/
+
+#include "nursery.hpp"
+#include <algorithm>
+#include <cstdint>
+using namespace std;
+
+Nursery::Nursery() : current_(nullptr)
+{
+	newChunk();
+}
+
+/**
+@name:		get
+@purpose:	returns the nursery shared by every interpreter and VM in the process
+@param:		null
+@return:	Nursery &
+*/
+Nursery& Nursery::get()
+{
+	// never destroyed, since values in static storage may still be freed into it at exit
+	static Nursery * nursery = new Nursery();
+	return *nursery;
+}
+
+/**
+@name:		chunkOf
+@purpose:	returns the chunk an object was allocated from
+@param:		void const *
+@return:	Chunk *
+*/
+Nursery::Chunk * Nursery::chunkOf(void const * ptr)
+{
+	return reinterpret_cast<Chunk *>(reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t(CHUNK_SIZE) - 1));
+}
+
+/**
+@name:		firstObject
+@purpose:	returns where a chunk's objects start, past its header
+@param:		Chunk *
+@return:	char *
+*/
+char * Nursery::firstObject(Chunk * chunk)
+{
+	return reinterpret_cast<char *>(chunk) + (sizeof(Chunk) + ALIGN - 1) / ALIGN * ALIGN;
+}
+
+/**
+@name:		newChunk
+@purpose:	makes an empty chunk current, reusing one whose objects have all died if there is one
+@param:		null
+@return:	void
+*/
+void Nursery::newChunk()
+{
+	if (!free_.empty())
+	{
+		current_ = free_.back();
+		free_.pop_back();
+	}
+	else
+	{
+		char * base = static_cast<char *>(::operator new(CHUNK_SIZE, align_val_t(CHUNK_SIZE)));
+		chunks_.insert(upper_bound(chunks_.begin(), chunks_.end(), base), base);
+		current_ = reinterpret_cast<Chunk *>(base);
+	}
+
+	current_->next_ = firstObject(current_);
+	current_->live_ = 0;
+}
+
+/**
+@name:		allocate
+@purpose:	returns memory for a new object from the current chunk
+@param:		std::size_t
+@return:	void *
+*/
+void * Nursery::allocate(std::size_t size)
+{
+	if (size > MAX_OBJECT)
+		return allocateOld(size);
+
+	size = (size + ALIGN - 1) / ALIGN * ALIGN;
+	if (current_->next_ + size > reinterpret_cast<char *>(current_) + CHUNK_SIZE)
+		newChunk();
+
+	void * ptr = current_->next_;
+	current_->next_ += size;
+	++current_->live_;
+	return ptr;
+}
+
+/**
+@name:		allocateOld
+@purpose:	returns memory from the general heap for an object that is not young, which deallocate frees as well
+@param:		std::size_t
+@return:	void *
+*/
+void * Nursery::allocateOld(std::size_t size)
+{
+	return ::operator new(size);
+}
+
+/**
+@name:		deallocate
+@purpose:	frees an object, reclaiming its chunk once nothing in it is alive
+@param:		void *
+@return:	void
+*/
+void Nursery::deallocate(void * ptr)
+{
+	// objects too large for a chunk, and operands made with new (promoted ones included), came from allocateOld
+	Chunk * chunk = chunkOf(ptr);
+	if (chunk != current_ && !isYoung(ptr))
+	{
+		::operator delete(ptr);
+		return;
+	}
+
+	if (--chunk->live_ != 0)
+		return;
+
+	if (chunk == current_)
+		current_->next_ = firstObject(current_);
+	else
+		free_.push_back(chunk);
+}
+
+/**
+@name:		isYoung
+@purpose:	checks whether an object was allocated from one of the nursery's chunks
+@param:		void const *
+@return:	bool
+*/
+bool Nursery::isYoung(void const * ptr) const
+{
+	char const * base = reinterpret_cast<char const *>(chunkOf(ptr));
+	return binary_search(chunks_.begin(), chunks_.end(), base);
+}
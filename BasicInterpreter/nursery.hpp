@@ -0,0 +1,67 @@
+/**	@file nursery.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the young generation that boxed operands are allocated from
+*/
+
+#pragma once
+#include "ref.hpp"
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Words, and integers and floats too large to store inline, are allocated by bumping a pointer through
+// a chunk. Most of them are intermediate results that die at once; when every object in the current
+// chunk is dead the chunk is reused from the start, and a chunk left behind is reused whole once its
+// last object dies. Values stored in a variable or a field are promoted (see Value::promote) so that
+// the few survivors do not keep young chunks alive.
+class Nursery
+{
+private:
+	static std::size_t const CHUNK_SIZE = 32 * 1024;		// chunks are aligned to their size, so an object finds its chunk by masking
+	static std::size_t const MAX_OBJECT = 1024;				// anything larger comes from the general heap
+	static std::size_t const ALIGN = alignof(std::max_align_t);
+
+	struct Chunk
+	{
+		char * next_;
+		std::size_t live_;
+	};
+
+	Chunk * current_;
+	std::vector<Chunk *> free_;
+	std::vector<char const *> chunks_;		// every chunk, sorted, to tell young objects apart
+
+public:
+	static Nursery& get();
+
+	template <typename T, typename... Args>
+	Ref<T> make(Args&&... args);
+
+	void * allocate(std::size_t size);
+	void * allocateOld(std::size_t size);
+	void deallocate(void * ptr);
+	bool isYoung(void const * ptr) const;
+
+private:
+	Nursery();
+	static Chunk * chunkOf(void const * ptr);
+	static char * firstObject(Chunk * chunk);
+	void newChunk();
+};
+
+/**
+@name:		make
+@purpose:	creates an object in the nursery, the class must free it through deallocate (see Operand)
+@param:		Args&&...
+@return:	Ref<T>
+*/
+template <typename T, typename... Args>
+Ref<T> Nursery::make(Args&&... args)
+{
+	static_assert(alignof(T) <= alignof(std::max_align_t), "the nursery only aligns to max_align_t");
+	return Ref<T>(::new (allocate(sizeof(T))) T(std::forward<Args>(args)...));
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "token.hpp"
+#include "nursery.hpp"
 #include <cassert>
 
 class Operand : public Token
@@ -16,6 +17,11 @@ class Operand : public Token
 public:
 	DEF_POINTER_TYPE(Operand)
 		DEF_IS_CONVERTIBLE_FROM(Operand)
+
+	// an operand made with new lives on the general heap, while Value puts its words and numbers in the
+	// nursery with Nursery::make; the nursery hands out and frees both kinds, and tells them apart
+	static void * operator new(std::size_t size) { return Nursery::get().allocateOld(size); }
+	static void operator delete(void * ptr) { Nursery::get().deallocate(ptr); }
 };
 
 template<typename new_type, typename old_type>
@@ -27,5 +33,5 @@ Operand::pointer_type make_operand(old_type const& param)
 template<typename operand_type>
 typename operand_type::value_type getValue(Token::pointer_type const& operand)
 {
-	return dynamic_cast<operand_type*>(operand.get())->getValue();
+	return static_cast<operand_type*>(operand.get())->getValue();
 }
\ No newline at end of file
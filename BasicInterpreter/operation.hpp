@@ -9,26 +9,33 @@
 #pragma once
 
 #include "operand.hpp"
-#include <stack>
+#include "value.hpp"
 #include <exception>
 
 class Operation : public Token
 {
 public:
 	DEF_POINTER_TYPE(Operation)
+	DEF_IS_CONVERTIBLE_FROM(Operation)
 	virtual unsigned numberOfArgs() const = 0;
-	virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&) = 0;
 };
 
-class MiscOperators : public Token {};
+class MiscOperators : public Token
+{
+	DEF_IS_CONVERTIBLE_FROM(MiscOperators)
+};
 
-	class Brackets : public MiscOperators {};
+	class Brackets : public MiscOperators
+	{
+		DEF_IS_CONVERTIBLE_FROM(Brackets)
+	};
 
 		class LeftBracket : public Brackets
 		{
 		public:
 			DEF_POINTER_TYPE(LeftBracket)
 			DEF_IS_CONVERTIBLE_FROM(LeftBracket)
+			LeftBracket() { kind_ = first_kind; }
 				string_type toString() const { return "("; }
 		};
 
@@ -37,16 +44,21 @@ class MiscOperators : public Token {};
 		public:
 			DEF_POINTER_TYPE(RightBracket)
 			DEF_IS_CONVERTIBLE_FROM(RightBracket)
+			RightBracket() { kind_ = first_kind; }
 				string_type toString() const { return ")"; }
 		};
 	
-	class Braces : public MiscOperators {};
+	class Braces : public MiscOperators
+	{
+		DEF_IS_CONVERTIBLE_FROM(Braces)
+	};
 		
 		class LeftBrace : public Braces
 		{
 		public:
 			DEF_POINTER_TYPE(LeftBrace)
 			DEF_IS_CONVERTIBLE_FROM(LeftBrace)
+			LeftBrace() { kind_ = first_kind; }
 			string_type toString() const { return "{"; }
 		};
 
@@ -55,6 +67,7 @@ class MiscOperators : public Token {};
 		public:
 			DEF_POINTER_TYPE(RightBrace)
 			DEF_IS_CONVERTIBLE_FROM(RightBrace)
+			RightBrace() { kind_ = first_kind; }
 			string_type toString() const { return "}"; }
 		};
 
@@ -64,6 +77,7 @@ class MiscOperators : public Token {};
 	public:
 		DEF_POINTER_TYPE(Assignment)
 		DEF_IS_CONVERTIBLE_FROM(Assignment)
+		Assignment() { kind_ = first_kind; }
 		string_type toString() const { return "="; }
 	};
 	
@@ -72,6 +86,7 @@ class MiscOperators : public Token {};
 	public:
 		DEF_POINTER_TYPE(ArgSeparator)
 		DEF_IS_CONVERTIBLE_FROM(ArgSeparator)
+		ArgSeparator() { kind_ = first_kind; }
 			string_type toString() const { return ""; }
 	};
 
@@ -80,6 +95,7 @@ class MiscOperators : public Token {};
 	public:
 		DEF_POINTER_TYPE(SemiColon)
 		DEF_IS_CONVERTIBLE_FROM(SemiColon)
+		SemiColon() { kind_ = first_kind; }
 			string_type toString() const { return ";"; }
 	};
 
@@ -88,6 +104,7 @@ class MiscOperators : public Token {};
 	public:
 		DEF_POINTER_TYPE(Colon)
 		DEF_IS_CONVERTIBLE_FROM(Colon)
+		Colon() { kind_ = first_kind; }
 		string_type toString() const { return ":"; }
 	};
 
@@ -96,6 +113,7 @@ class MiscOperators : public Token {};
 	public:
 		DEF_POINTER_TYPE(Comma)
 		DEF_IS_CONVERTIBLE_FROM(Comma)
+		Comma() { kind_ = first_kind; }
 			string_type toString() const { return ","; }
 	};
 
@@ -104,5 +122,6 @@ class MiscOperators : public Token {};
 	public:
 		DEF_POINTER_TYPE(Dot)
 		DEF_IS_CONVERTIBLE_FROM(Dot)
+		Dot() { kind_ = first_kind; }
 		string_type toString() const { return "."; }
 	};
\ No newline at end of file
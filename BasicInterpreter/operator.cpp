@@ -9,30 +9,46 @@
 #include "operator.hpp"
 #include "operation.hpp"
 #include "token.hpp"
-#include "integer.hpp"
-#include "float.hpp"
-#include "boolean.hpp"
-#include "word.hpp"
+#include "value.hpp"
 #include "oper_exceptions.hpp"
-#include <stack>
+#include "checked_math.hpp"
+#include "dispatch.hpp"
 #include <exception>
+#include <functional>
 
 
 /**
 @name:		perform
 @purpose:	performs a factorial calculation on an operand
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &
+@return:	Value
 */
-Operand::pointer_type Factorial::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Factorial::perform(Value const& fac)
 {
-	auto fac = valueStack.top();
-	valueStack.pop();
-	Operand::pointer_type fin;
+	Value fin;
 
-	if (is<Integer>(fac))
+	// multiply in 64 bits until the product overflows, then start over with cpp_int
+	if (fac.isSmallInt())
 	{
-		auto val = getValue<Integer>(fac);
+		std::int64_t val = fac.asSmallInt();
+		std::int64_t facVal = val;
+		bool overflow = false;
+
+		if (val != 0)
+		{
+			facVal = 1;
+			std::int64_t step = val > 0 ? -1 : 1;
+			for (; val != 0 && !overflow; val += step)
+				overflow = checkedMul(facVal, val, facVal);
+		}
+
+		if (!overflow)
+			return Value(facVal);
+	}
+
+	if (fac.isInt())
+	{
+		auto val = fac.toInteger();
 		Integer::value_type facVal;
 		if (val > 0)
 		{
@@ -59,13 +75,13 @@ Operand::pointer_type Factorial::perform(std::stack<Operand::pointer_type>& valu
 			facVal = val;
 		}
 
-		fin = make_operand<Integer>(facVal);
+		fin = Value(facVal);
 	}
-	else if (is<Float>(fac))
+	else if (fac.isFloat())
 	{
 		throw UnOpException("Factorial", "Real");
 	}
-	else if (is<Boolean>(fac))
+	else if (fac.isBool())
 	{
 		throw UnOpException("Factorial", "Boolean");
 	}
@@ -76,64 +92,53 @@ Operand::pointer_type Factorial::perform(std::stack<Operand::pointer_type>& valu
 /**
 @name:		perform
 @purpose:	makes a number positive
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &
+@return:	Value
 */
-Operand::pointer_type Identity::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Identity::perform(Value const& oper)
 {
-	auto oper = valueStack.top();
-	valueStack.pop();
-
-	if (is<Boolean>(oper))
+	if (oper.isBool())
 		throw UnOpException("Identity", "Boolean");
-	else if (is<Word>(oper))
+	else if (oper.isWord())
 		throw UnOpException("Identity", "Word");
-	else if (is<Integer>(oper))
-	{
-		if (convert<Integer>(oper)->getValue() < 0)
-			convert<Integer>(oper)->getValue() * -1;
-	}
-	else
-	{
-		if (convert<Float>(oper)->getValue() < 0)
-			convert<Float>(oper)->getValue() * -1;
-	}
+
 	return oper;
 }
 
 /**
 @name:		perform
 @purpose:	makes a number negative
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &
+@return:	Value
 */
-Operand::pointer_type Negation::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Negation::perform(Value const& oper)
 {
-	auto oper = valueStack.top();
-	Operand::pointer_type fin;
-	valueStack.pop();
+	Value fin;
 
-	if (is<Integer>(oper))
+	if (oper.isSmallInt())
+		return oper.asSmallInt() > 0 ? Value(-oper.asSmallInt()) : oper;
+
+	if (oper.isInt())
 	{
-		auto val = getValue<Integer>(oper);
+		auto val = oper.toInteger();
 		if (val > 0)
 		{
 			val *= -1;
 		}
-		fin = make_operand<Integer>(val);
+		fin = Value(val);
 	}
-	else if (is<Float>(oper))
+	else if (oper.isFloat())
 	{
-		auto val = getValue<Float>(oper);
+		auto val = oper.toFloat();
 		if (val > 0)
 		{
 			val *= -1;
 		}
-		fin = make_operand<Float>(val);
+		fin = Value(val);
 	}
-	else if (is<Boolean>(oper))
+	else if (oper.isBool())
 		throw UnOpException("Negation", "Boolean");
-	else if (is<Word>(oper))
+	else if (oper.isWord())
 		throw UnOpException("Negation", "Word");
 
 	return fin;
@@ -142,23 +147,21 @@ Operand::pointer_type Negation::perform(std::stack<Operand::pointer_type>& value
 /**
 @name:		perform
 @purpose:	flips a boolean's state
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &
+@return:	Value
 */
-Operand::pointer_type Not::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Not::perform(Value const& notter)
 {
-	auto notter = valueStack.top();
-	Operand::pointer_type fin;
-	valueStack.pop();
+	Value fin;
 
-	if (is<Integer>(notter))
+	if (notter.isInt())
 		throw UnOpException("Not", "Integer");
-	else if (is<Float>(notter))
+	else if (notter.isFloat())
 		throw UnOpException("Not", "Float");
-	else if (is<Word>(notter))
+	else if (notter.isWord())
 		throw UnOpException("Not", "Word");
-	else if (is<Boolean>(notter))
-		fin = make_operand<Boolean>(!getValue<Boolean>(notter));
+	else if (notter.isBool())
+		fin = Value(!notter.asBool());
 
 	return fin;
 }
@@ -179,1228 +182,437 @@ Integer::value_type int_power(Integer::value_type val, Integer::value_type _pow)
 }
 
 /**
-@name:		perform
-@purpose:	raises one number to the power of another
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@name:		concatenate
+@purpose:	joins the text of two values, at least one of which is a word
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Power::perform(std::stack<Operand::pointer_type>& valueStack)
+Value concatenate(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	// possible first values
-	Integer::value_type val_one_int;
-	Float::value_type val_one_real;
+	return Value(first.toString() + second.toString());
+}
 
-	// possible second values
-	Integer::value_type val_two_int;
-	Float::value_type val_two_real;
+// The kernels below are plugged into each operator's table by makeBinaryTable and makeNumericTable.
+// integers() receives both operands, floats() and booleans() receive the converted values.
 
+struct PowerKernels
+{
+	static constexpr char const* name = "Power";
 
-	if (is<Integer>(first))
+	static Value integers(Value const& first, Value const& second)
 	{
-		val_one_int = getValue<Integer>(first);
+		// non-negative powers of a 64-bit base, only promote to cpp_int if the result overflows
+		std::int64_t smallVal;
+		if (first.isSmallInt() && second.isSmallInt() && second.asSmallInt() >= 0 && !checkedPow(first.asSmallInt(), second.asSmallInt(), smallVal))
+			return Value(smallVal);
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
+		Integer::value_type exponent = second.toInteger();
+		if (exponent < 0)
+			return Value(floats(first.toFloat(), second.toFloat()));
 
-			Integer::value_type finVal;
-			Float::value_type finValR;
-
-			if (val_two_int < 0)
-			{
-				finValR = boost::multiprecision::pow(static_cast<Float::value_type>(val_one_int), static_cast<Float::value_type>(val_two_int));
-				fin = make_operand<Float>(finValR);
-			}
-			else
-			{
-				finVal = int_power(val_one_int, val_two_int);
-				fin = make_operand<Integer>(finVal);
-			}
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = boost::multiprecision::pow(static_cast<Float::value_type>(val_one_int), val_two_real);
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Power", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Power", "Integer", "Word");
+		return Value(int_power(first.toInteger(), exponent));
 	}
+	static Float::value_type floats(Float::value_type first, Float::value_type second) { return float_math::pow(first, second); }
+};
 
-	else if (is<Float>(first))
-	{
-		val_one_real = getValue<Float>(first);
-
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Float::value_type finVal = boost::multiprecision::pow(val_one_real, static_cast<Float::value_type>(val_two_int));
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = boost::multiprecision::pow(val_one_real, val_two_real);
-			fin = make_operand<Float>(finVal);
-		}
+struct AdditionKernels
+{
+	static constexpr char const* name = "Addition";
 
-		else if (is<Boolean>(second))
-			throw BinOpException("Power", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Power", "Float", "Word");
+	static Value integers(Value const& first, Value const& second)
+	{
+		// both operands fit in 64 bits, only promote to cpp_int if the sum overflows
+		std::int64_t smallVal;
+		if (first.isSmallInt() && second.isSmallInt() && !checkedAdd(first.asSmallInt(), second.asSmallInt(), smallVal))
+			return Value(smallVal);
 
+		return Value(Integer::value_type(first.toInteger() + second.toInteger()));
 	}
-	else if (is<Boolean>(first))
-		throw BinOpException("Power", "Boolean", "any operator");
-	else if (is<Word>(first))
-		throw BinOpException("Power", "Word", "any operator");
+	static Float::value_type floats(Float::value_type first, Float::value_type second) { return first + second; }
+	static bool booleans(bool first, bool second) { return first || second; }
+};
 
-	return fin;
-}
-
-/**
-@name:		perform
-@purpose:	adds two numbers
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
-*/
-Operand::pointer_type Addition::perform(std::stack<Operand::pointer_type>& valueStack)
+struct SubtractionKernels
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-	Operand::pointer_type fin;
-
-	// possible first values
-	Integer::value_type val_one_int;
-	Float::value_type val_one_real;
-	Boolean::value_type val_one_bool;
-	Word::value_type val_one_word;
-
-	// possible second values
-	Integer::value_type val_two_int;
-	Float::value_type val_two_real;
-	Boolean::value_type val_two_bool;
-	Word::value_type val_two_word;
-
-
-	if (is<Integer>(first))
+	static constexpr char const* name = "Subtraction";
+
+	static Value integers(Value const& first, Value const& second)
 	{
-		val_one_int = getValue<Integer>(first);
+		// both operands fit in 64 bits, only promote to cpp_int if the difference overflows
+		std::int64_t smallVal;
+		if (first.isSmallInt() && second.isSmallInt() && !checkedSub(first.asSmallInt(), second.asSmallInt(), smallVal))
+			return Value(smallVal);
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Integer::value_type finVal = val_one_int + val_two_int;
-			fin = make_operand<Integer>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = static_cast<Float::value_type>(val_one_int) + val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Addition", "Integer", "Boolean");
-		else if (is<Word>(second))
-		{
-			val_two_word = getValue<Word>(second);
-			fin = make_operand<Word>(boost::lexical_cast<string_type>(val_one_int) + val_two_word);
-		}
+		return Value(Integer::value_type(first.toInteger() - second.toInteger()));
 	}
-	// if first value is a Real
-	else if (is<Float>(first))
-	{
-		val_one_real = getValue<Float>(first);
+	static Float::value_type floats(Float::value_type first, Float::value_type second) { return first - second; }
+};
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Float::value_type finVal = val_one_real + static_cast<Float::value_type>(val_two_int);
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = val_one_real + val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Addition", "Float", "Boolean");
-		else if (is<Word>(second))
-		{
-			val_two_word = getValue<Word>(second);
-			fin = make_operand<Word>(boost::lexical_cast<string_type>(val_one_real) + val_two_word);
-		}
+struct MultiplicationKernels
+{
+	static constexpr char const* name = "Multiplication";
 
-	}
-	// if the first value is a Boolean
-	else if (is<Boolean>(first))
+	static Value integers(Value const& first, Value const& second)
 	{
-		val_one_bool = getValue<Boolean>(first);
+		// both operands fit in 64 bits, only promote to cpp_int if the product overflows
+		std::int64_t smallVal;
+		if (first.isSmallInt() && second.isSmallInt() && !checkedMul(first.asSmallInt(), second.asSmallInt(), smallVal))
+			return Value(smallVal);
 
-		if (is<Integer>(second))
-			throw BinOpException("Addition", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Addition", "Boolean", "Float");
-		else if (is<Word>(second))
-		{
-			string_type boolVal = val_one_bool == true ? "true" : "false";
-			val_two_word = getValue<Word>(second);
-			val_two_word = boolVal + val_two_word;
-			fin = make_operand<Word>(val_two_word);
-		}
-		else if (is<Boolean>(second))
-		{
-			val_two_bool = getValue<Boolean>(second);
-			bool finVal = val_one_bool || val_two_bool;
-			fin = make_operand<Boolean>(finVal);
-		}
-	}
-	else if (is<Word>(first))
-	{
-		val_one_word = getValue<Word>(first);
-		
-		if (is<Word>(second))
-			fin = make_operand<Word>(val_one_word + getValue<Word>(second));
-		else if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			fin = make_operand<Word>(val_one_word + boost::lexical_cast<string_type>(val_two_int));
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			fin = make_operand<Word>(val_one_word + boost::lexical_cast<string_type>(val_two_real));
-		}
-		else if (is<Boolean>(second))
-		{
-			val_two_bool = getValue<Boolean>(second);
-			string_type boolVal = val_two_bool == true ? "true" : "false";
-			fin = make_operand<Word>(val_one_word + boolVal);
-		}
+		return Value(Integer::value_type(first.toInteger() * second.toInteger()));
 	}
+	static Float::value_type floats(Float::value_type first, Float::value_type second) { return first * second; }
+};
 
-	return fin;
+// dividing by zero and the one overflowing quotient are left to cpp_int, which reports them
+inline bool smallDivisible(Value const& first, Value const& second)
+{
+	return first.isSmallInt() && second.isSmallInt() && second.asSmallInt() != 0 &&
+		!(second.asSmallInt() == -1 && first.asSmallInt() == (std::numeric_limits<std::int64_t>::min)());
 }
 
-/**
-@name:		perform
-@purpose:	subtracts two number
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
-*/
-Operand::pointer_type Subtraction::perform(std::stack<Operand::pointer_type>& valueStack)
+struct DivisionKernels
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-	Operand::pointer_type fin;
+	static constexpr char const* name = "Division";
 
-	// possible first values
-	Integer::value_type val_one_int;
-	Float::value_type val_one_real;
+	static Value integers(Value const& first, Value const& second)
+	{
+		if (smallDivisible(first, second))
+			return Value(std::int64_t(first.asSmallInt() / second.asSmallInt()));
 
-	// possible second values
-	Integer::value_type val_two_int;
-	Float::value_type val_two_real;
+		return Value(Integer::value_type(first.toInteger() / second.toInteger()));
+	}
+	static Float::value_type floats(Float::value_type first, Float::value_type second) { return first / second; }
+};
 
+struct ModulusKernels
+{
+	static constexpr char const* name = "Modulus";
 
-	if (is<Integer>(first))
+	static Value integers(Value const& first, Value const& second)
 	{
-		val_one_int = getValue<Integer>(first);
+		if (smallDivisible(first, second))
+			return Value(std::int64_t(first.asSmallInt() % second.asSmallInt()));
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Integer::value_type finVal = val_one_int - val_two_int;
-			fin = make_operand<Integer>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = static_cast<Float::value_type>(val_one_int) - val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Subtraction", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Subtraction", "Integer", "Word");
+		return Value(Integer::value_type(first.toInteger() % second.toInteger()));
 	}
-	// if first value is a Real
-	else if (is<Float>(first))
-	{
-		val_one_real = getValue<Float>(first);
+};
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Float::value_type finVal = val_one_real - static_cast<Float::value_type>(val_two_int);
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = val_one_real - val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Subtraction", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Subtraction", "Float", "Word");
-	}
-	else if (is<Boolean>(first))
-		throw BinOpException("Subtraction", "Boolean", "Any Operand");
-	else if (is<Word>(first))
-		throw BinOpException("Subtraction", "Word", "Any Operand");
-
-	return fin;
-}
+struct AndKernels
+{
+	static constexpr char const* name = "And";
+	static bool booleans(bool first, bool second) { return first && second; }
+};
 
-/**
-@name:		perform
-@purpose:	multiplies two number
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
-*/
-Operand::pointer_type Multiplication::perform(std::stack<Operand::pointer_type>& valueStack)
+struct NandKernels
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-	Operand::pointer_type fin;
+	static constexpr char const* name = "Nand";
+	static bool booleans(bool first, bool second) { return !(first && second); }
+};
 
-	// possible first values
-	Integer::value_type val_one_int;
-	Float::value_type val_one_real;
+struct OrKernels
+{
+	static constexpr char const* name = "Or";
+	static bool booleans(bool first, bool second) { return first || second; }
+};
 
-	// possible second values
-	Integer::value_type val_two_int;
-	Float::value_type val_two_real;
+struct NorKernels
+{
+	static constexpr char const* name = "Nor";
+	static bool booleans(bool first, bool second) { return !(first || second); }
+};
 
+struct XorKernels
+{
+	static constexpr char const* name = "Xor";
+	static bool booleans(bool first, bool second) { return first != second; }
+};
 
-	if (is<Integer>(first))
-	{
-		val_one_int = getValue<Integer>(first);
+struct XnorKernels
+{
+	static constexpr char const* name = "Xnor";
+	static bool booleans(bool first, bool second) { return first == second; }
+};
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Integer::value_type finVal = val_one_int * val_two_int;
-			fin = make_operand<Integer>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = static_cast<Float::value_type>(val_one_int) * val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Multiplication", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Multiplication", "Integer", "Word");
-	}
-	// if first value is a Real
-	else if (is<Float>(first))
+// relational operators share their kernels and differ only by the comparison
+template <typename Compare>
+struct RelationKernels
+{
+	static Value integers(Value const& first, Value const& second)
 	{
-		val_one_real = getValue<Float>(first);
+		if (first.isSmallInt() && second.isSmallInt())
+			return Value(Compare()(first.asSmallInt(), second.asSmallInt()));
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Float::value_type finVal = val_one_real * static_cast<Float::value_type>(val_two_int);
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = val_one_real * val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Multiplication", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Multiplication", "Float", "Word");
+		return Value(Compare()(first.toInteger(), second.toInteger()));
 	}
-	// if the first value is a Boolean
-	else if (is<Boolean>(first))
-		throw BinOpException("Multiplication", "Boolean", "Any Operand");
-	else if (is<Word>(first))
-		throw BinOpException("Multiplication", "Word", "Any Operand");
+	static bool floats(Float::value_type const& first, Float::value_type const& second) { return Compare()(first, second); }
+	static bool booleans(bool first, bool second) { return Compare()(first, second); }
+};
 
-	return fin;
-}
+struct EqualityKernels : RelationKernels<std::equal_to<>> { static constexpr char const* name = "Equality"; };
+struct InequalityKernels : RelationKernels<std::not_equal_to<>> { static constexpr char const* name = "Inequality"; };
+struct GreaterKernels : RelationKernels<std::greater<>> { static constexpr char const* name = "Greater"; };
+struct GreaterEqualKernels : RelationKernels<std::greater_equal<>> { static constexpr char const* name = "GreaterEqual"; };
+struct LessKernels : RelationKernels<std::less<>> { static constexpr char const* name = "Less"; };
+struct LessEqualKernels : RelationKernels<std::less_equal<>> { static constexpr char const* name = "LessEqual"; };
 
 /**
 @name:		perform
-@purpose:	divides two numbers
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@purpose:	raises one number to the power of another
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Division::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Power::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-	Operand::pointer_type fin;
-
-	// possible first values
-	Integer::value_type val_one_int;
-	Float::value_type val_one_real;
-
-	// possible second values
-	Integer::value_type val_two_int;
-	Float::value_type val_two_real;
-
-
-	if (is<Integer>(first))
-	{
-		val_one_int = getValue<Integer>(first);
+	static constexpr BinaryTable table = makeNumericTable<PowerKernels>();
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Integer::value_type finVal = val_one_int / val_two_int;
-			fin = make_operand<Integer>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = static_cast<Float::value_type>(val_one_int) / val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Division", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Division", "Integer", "Word");
-	}
-	// if first value is a Real
-	else if (is<Float>(first))
-	{
-		val_one_real = getValue<Float>(first);
-
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Float::value_type finVal = val_one_real / static_cast<Float::value_type>(val_two_int);
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			val_two_real = getValue<Float>(second);
-			Float::value_type finVal = val_one_real / val_two_real;
-			fin = make_operand<Float>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Division", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Division", "Float", "Word");
-	}
-	// if the first value is a Boolean
-	else if (is<Boolean>(first))
-		throw BinOpException("Division", "Boolean", "Any Operand");
-	else if (is<Word>(first))
-		throw BinOpException("Division", "Word", "Any Operand");
+	return dispatch(table, first, second);
+}
 
-	return fin;
+/**
+@name:		perform
+@purpose:	adds two numbers, joins a word with any value, or ors two booleans
+@param:		Value const &, Value const &
+@return:	Value
+*/
+Value Addition::perform(Value const& first, Value const& second)
+{
+	static constexpr BinaryTable table = makeNumericTable<AdditionKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<AdditionKernels> },
+		{ Value::Kind::INT,		Value::Kind::WORD,	&concatenate },
+		{ Value::Kind::FLOAT,	Value::Kind::WORD,	&concatenate },
+		{ Value::Kind::BOOL,	Value::Kind::WORD,	&concatenate },
+		{ Value::Kind::WORD,	Value::Kind::INT,	&concatenate },
+		{ Value::Kind::WORD,	Value::Kind::FLOAT,	&concatenate },
+		{ Value::Kind::WORD,	Value::Kind::BOOL,	&concatenate },
+		{ Value::Kind::WORD,	Value::Kind::WORD,	&concatenate }
+	});
+
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
-@purpose:	performs a modulo operation on two number
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@purpose:	subtracts two number
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Modulus::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Subtraction::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
+	static constexpr BinaryTable table = makeNumericTable<SubtractionKernels>();
 
-	Operand::pointer_type fin;
+	return dispatch(table, first, second);
+}
 
-	// possible first values
-	Integer::value_type val_one_int;
+/**
+@name:		perform
+@purpose:	multiplies two number
+@param:		Value const &, Value const &
+@return:	Value
+*/
+Value Multiplication::perform(Value const& first, Value const& second)
+{
+	static constexpr BinaryTable table = makeNumericTable<MultiplicationKernels>();
 
-	// possible second values
-	Integer::value_type val_two_int;
+	return dispatch(table, first, second);
+}
 
+/**
+@name:		perform
+@purpose:	divides two number
+@param:		Value const &, Value const &
+@return:	Value
+*/
+Value Division::perform(Value const& first, Value const& second)
+{
+	static constexpr BinaryTable table = makeNumericTable<DivisionKernels>();
 
-	if (is<Integer>(first))
-	{
-		val_one_int = getValue<Integer>(first);
+	return dispatch(table, first, second);
+}
 
-		if (is<Integer>(second))
-		{
-			val_two_int = getValue<Integer>(second);
-			Integer::value_type finVal = val_one_int % val_two_int;
-			fin = make_operand<Integer>(finVal);
-		}
-		else if (is<Float>(second))
-			throw BinOpException("Modulus", "Integer", "Real");
-		else if (is<Boolean>(second))
-			throw BinOpException("Modulus", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Modulus", "Integer", "Word");
-	}
-	// if first value is a Real
-	else if (is<Float>(first))
-		throw BinOpException("Modulus", "Float", "Any Operand");
-	// if the first value is a Boolean
-	else if (is<Boolean>(first))
-		throw BinOpException("Modulus", "Boolean", "Any Operand");
-	else if (is<Word>(first))
-		throw BinOpException("Modulus", "Word", "Any Operand");
+/**
+@name:		perform
+@purpose:	performs a modulo operation on two integers
+@param:		Value const &, Value const &
+@return:	Value
+*/
+Value Modulus::perform(Value const& first, Value const& second)
+{
+	static constexpr BinaryTable table = makeBinaryTable<ModulusKernels>({
+		{ Value::Kind::INT,	Value::Kind::INT,	&integerKernel<ModulusKernels> }
+	});
 
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	performs and And operation on two booleans
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type And::perform(std::stack<Operand::pointer_type>& valueStack)
+Value And::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-	{
-		throw UnOpException("And", "Integer");
-	}
-	else if (is<Float>(first))
-	{
-		throw UnOpException("And", "Float");
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("And", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("And", "Boolean", "Float");
-		else if (is<Word>(second))
-			throw BinOpException("And", "Boolean", "Word");
-		else if (is<Boolean>(second))
-		{
-			auto val_two = getValue<Boolean>(second);
-			auto finVal = (val_one && val_two);
+	static constexpr BinaryTable table = makeBinaryTable<AndKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<AndKernels> }
+	});
 
-			fin = make_operand<Boolean>(finVal);
-		}
-	}
-	else if (is<Word>(first))
-		throw BinOpException("And", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	performs and Or operation on two booleans
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Or::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Or::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-		throw UnOpException("Or", "Integer");
-	else if (is<Float>(first))
-		throw UnOpException("Or", "Float");
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Or", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Or", "Boolean", "Float");
-		else if (is<Word>(second))
-			throw BinOpException("Or", "Boolean", "Word");
-		else if (is<Boolean>(second))
-		{
-			auto val_two = getValue<Boolean>(second);
-			auto finVal = (val_one || val_two);
+	static constexpr BinaryTable table = makeBinaryTable<OrKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<OrKernels> }
+	});
 
-			fin = make_operand<Boolean>(finVal);
-		}
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Or", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	performs and Nor operation on two booleans
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Nor::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Nor::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-		throw UnOpException("Nor", "Integer");
-	else if (is<Float>(first))
-		throw UnOpException("Nor", "Float");
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Nor", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Nor", "Boolean", "Float");
-		else if (is<Word>(second))
-			throw BinOpException("Nor", "Boolean", "Word");
-		else if (is<Boolean>(second))
-		{
-			auto val_two = getValue<Boolean>(second);
-			auto finVal = !(val_one || val_two);
+	static constexpr BinaryTable table = makeBinaryTable<NorKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<NorKernels> }
+	});
 
-			fin = make_operand<Boolean>(finVal);
-		}
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Nor", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	performs and Xor operation on two booleans
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Xor::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Xor::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
+	static constexpr BinaryTable table = makeBinaryTable<XorKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<XorKernels> }
+	});
 
-	if (is<Integer>(first))
-	{
-		throw UnOpException("Xor", "Integer");
-	}
-	else if (is<Float>(first))
-	{
-		throw UnOpException("Xor", "Float");
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Xor", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Xor", "Boolean", "Float");
-		else if (is<Word>(second))
-			throw BinOpException("Xor", "Boolean", "Word");
-		else if (is<Boolean>(second))
-		{
-			auto val_two = getValue<Boolean>(second);
-			auto finVal = ((val_one || val_two) && !(val_one && val_two));
-
-			fin = make_operand<Boolean>(finVal);
-		}
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Xor", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	performs and Xnor operation on two booleans
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Xnor::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Xnor::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
+	static constexpr BinaryTable table = makeBinaryTable<XnorKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<XnorKernels> }
+	});
 
-	if (is<Integer>(first))
-	{
-		throw UnOpException("Xnor", "Integer");
-	}
-	else if (is<Float>(first))
-	{
-		throw UnOpException("Xnor", "Float");
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Xnor", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Xnor", "Boolean", "Float");
-		else if (is<Word>(second))
-			throw BinOpException("Xnor", "Boolean", "Word");
-		else if (is<Boolean>(second))
-		{
-			auto val_two = getValue<Boolean>(second);
-			auto finVal = !((val_one || val_two) && !(val_one && val_two));
+	return dispatch(table, first, second);
+}
 
-			fin = make_operand<Boolean>(finVal);
-		}
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Xnor", "Word", "Any Operand");
+/**
+@name:		perform
+@purpose:	perfoms a Nand operation on two booleans
+@param:		Value const &, Value const &
+@return:	Value
+*/
+Value Nand::perform(Value const& first, Value const& second)
+{
+	static constexpr BinaryTable table = makeBinaryTable<NandKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<NandKernels> }
+	});
 
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	compares two operands that are the same type
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Equality::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Equality::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
+	static constexpr BinaryTable table = makeNumericTable<EqualityKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<EqualityKernels> }
+	});
 
-	if (is<Integer>(first))
-	{
-		auto val_one = getValue<Integer>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one == val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (static_cast<Float::value_type>(val_one) == val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Equality", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Equality", "Integer", "Word");
-	}
-	else if (is<Float>(first))
-	{
-		auto val_one = getValue<Float>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one == static_cast<Float::value_type>(val_two));
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (val_one == val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Equality", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Equality", "Float", "Word");
-
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Equality", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Equality", "Boolean", "Float");
-		else if (is<Boolean>(second))
-		{
-			auto val_two = getValue<Boolean>(second);
-			auto finVal = (val_one == val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Word>(second))
-			throw BinOpException("Equality", "Boolean", "Word");
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Equality", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	checks if one number is greater than another
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Greater::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Greater::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-	{
-		auto val_one = getValue<Integer>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one > val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (static_cast<Float::value_type>(val_one) > val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Greater", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Greater", "Integer", "Word");
-	}
-	else if (is<Float>(first))
-	{
-		auto val_one = getValue<Float>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one > static_cast<Float::value_type>(val_two));
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (val_one > val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Greater", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Greater", "Float", "Word");
-
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Greater", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Greater", "Boolean", "Float");
-		else if (is<Boolean>(second))
-			throw BinOpException("Greater", "Boolean", "Any Operand");
-		else if (is<Word>(second))
-			throw BinOpException("Greater", "Boolean", "Word");
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Greater", "Word", "Any Operand");
+	static constexpr BinaryTable table = makeNumericTable<GreaterKernels>();
 
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	checks if one number is greater than or equal to another
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type GreaterEqual::perform(std::stack<Operand::pointer_type>& valueStack)
+Value GreaterEqual::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-	{
-		auto val_one = getValue<Integer>(first);
+	static constexpr BinaryTable table = makeNumericTable<GreaterEqualKernels>();
 
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one >= val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (static_cast<Float::value_type>(val_one) >= val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("GreaterEqual", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("GreaterEqual", "Integer", "Word");
-	}
-	else if (is<Float>(first))
-	{
-		auto val_one = getValue<Float>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one >= static_cast<Float::value_type>(val_two));
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (val_one >= val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("GreaterEqual", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("GreaterEqual", "Float", "Word");
-
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("GreaterEqual", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("GreaterEqual", "Boolean", "Float");
-		else if (is<Boolean>(second))
-			throw BinOpException("GreaterEqual", "Boolean", "Any Operand");
-		else if (is<Word>(second))
-			throw BinOpException("GreaterEqual", "Boolean", "Word");
-	}
-	else if (is<Word>(first))
-		throw BinOpException("GreaterEqual", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	checks if two operands are not equal
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Inequality::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Inequality::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-	{
-		auto val_one = getValue<Integer>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one != val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (static_cast<Float::value_type>(val_one) != val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Inequality", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Inequality", "Integer", "Word");
-	}
-	else if (is<Float>(first))
-	{
-		auto val_one = getValue<Float>(first);
+	static constexpr BinaryTable table = makeNumericTable<InequalityKernels>({
+		{ Value::Kind::BOOL,	Value::Kind::BOOL,	&booleanKernel<InequalityKernels> }
+	});
 
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one != static_cast<Float::value_type>(val_two));
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (val_one != val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Inequality", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Inequality", "Float", "Word");
-
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Inequality", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Inequality", "Boolean", "Float");
-		else if (is<Boolean>(second))
-			throw BinOpException("Inequality", "Boolean", "Any Operand");
-		else if (is<Word>(second))
-			throw BinOpException("Inequality", "Float", "Word");
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Inequality", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	checks if one number is less than another
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Less::perform(std::stack<Operand::pointer_type>& valueStack)
+Value Less::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-	{
-		auto val_one = getValue<Integer>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one < val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (static_cast<Float::value_type>(val_one) < val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Less", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Less", "Integer", "Word");
-	}
-	else if (is<Float>(first))
-	{
-		auto val_one = getValue<Float>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one < static_cast<Float::value_type>(val_two));
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (val_one < val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("Less", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("Less", "Float", "Word");
+	static constexpr BinaryTable table = makeNumericTable<LessKernels>();
 
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Less", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Less", "Boolean", "Float");
-		else if (is<Boolean>(second))
-			throw BinOpException("Less", "Boolean", "Any Operand");
-		else if (is<Word>(second))
-			throw BinOpException("Less", "Boolean", "Word");
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Less", "Word", "Any Operand");
-
-	return fin;
+	return dispatch(table, first, second);
 }
 
 /**
 @name:		perform
 @purpose:	checks if one number is less than or equal to another
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
-*/
-Operand::pointer_type LessEqual::perform(std::stack<Operand::pointer_type>& valueStack)
-{
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-	{
-		auto val_one = getValue<Integer>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one <= val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (static_cast<Float::value_type>(val_one) <= val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("LessEqual", "Integer", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("LessEqual", "Integer", "Word");
-	}
-	else if (is<Float>(first))
-	{
-		auto val_one = getValue<Float>(first);
-
-		if (is<Integer>(second))
-		{
-			auto val_two = getValue<Integer>(second);
-			bool finVal = (val_one <= static_cast<Float::value_type>(val_two));
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Float>(second))
-		{
-			auto val_two = getValue<Float>(second);
-			bool finVal = (val_one <= val_two);
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Boolean>(second))
-			throw BinOpException("LessEqual", "Float", "Boolean");
-		else if (is<Word>(second))
-			throw BinOpException("LessEqual", "Float", "Word");
-
-	}
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("LessEqual", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("LessEqual", "Boolean", "Float");
-		else if (is<Boolean>(second))
-			throw BinOpException("LessEqual", "Boolean", "Any Operand");
-		else if (is<Word>(second))
-			throw BinOpException("LessEqual", "Boolean", "Word");
-	}
-	else if (is<Word>(first))
-		throw BinOpException("LessEqual", "Word", "Any Operand");
-
-	return fin;
-}
-
-/**
-@name:		perform
-@purpose:	perfoms a Nand operation on two booleans
-@param:		std::stack<Operand::pointer_type>&
-@return:	Operand::pointer_type
+@param:		Value const &, Value const &
+@return:	Value
 */
-Operand::pointer_type Nand::perform(std::stack<Operand::pointer_type>& valueStack)
+Value LessEqual::perform(Value const& first, Value const& second)
 {
-	auto first = valueStack.top();
-	valueStack.pop();
-	auto second = valueStack.top();
-	valueStack.pop();
-
-	Operand::pointer_type fin;
-
-	if (is<Integer>(first))
-		throw UnOpException("Nand", "Integer");
-	else if (is<Float>(first))
-		throw UnOpException("Nand", "Float");
-	else if (is<Boolean>(first))
-	{
-		auto val_one = getValue<Boolean>(first);
-
-		if (is<Integer>(second))
-			throw BinOpException("Nand", "Boolean", "Integer");
-		else if (is<Float>(second))
-			throw BinOpException("Nand", "Boolean", "Float");
-		else if (is<Boolean>(second))
-		{
-			auto val_two = getValue<Boolean>(second);
-			auto finVal = !(val_one && val_two);
+	static constexpr BinaryTable table = makeNumericTable<LessEqualKernels>();
 
-			fin = make_operand<Boolean>(finVal);
-		}
-		else if (is<Word>(second))
-			throw BinOpException("Nand", "Boolean", "Word");
-	}
-	else if (is<Word>(first))
-		throw BinOpException("Nand", "Word", "Any Operand");
-
-	return fin;
-}
+	return dispatch(table, first, second);
+}
\ No newline at end of file
@@ -19,42 +19,52 @@ class Operator : public Operation
 {
 public:
 	DEF_POINTER_TYPE(Operator)
+	DEF_IS_CONVERTIBLE_FROM(Operator)
 };
 
 	class UnaryOperator : public Operator
 	{
 	public:
 		DEF_POINTER_TYPE(UnaryOperator)
+		DEF_IS_CONVERTIBLE_FROM(UnaryOperator)
 		virtual unsigned numberOfArgs() const override { return 1; }
+		virtual Value perform(Value const& operand) = 0;
 	};
 
-		class NonAssocOperator : public UnaryOperator {};
+		class NonAssocOperator : public UnaryOperator
+		{
+			DEF_IS_CONVERTIBLE_FROM(NonAssocOperator)
+		};
 
 			class Factorial : public NonAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Factorial)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Factorial() { kind_ = first_kind; }
+					virtual Value perform(Value const&) override;
 				string_type toString() const { return "!"; }
 			};
 
 			class Identity : public NonAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Identity)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Identity() { kind_ = first_kind; }
+					virtual Value perform(Value const&) override;
 				string_type toString() const { return "+"; }
 			};
 
 			class Negation : public NonAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Negation)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Negation() { kind_ = first_kind; }
+					virtual Value perform(Value const&) override;
 				string_type toString() const { return "-"; }
 			};
 
 			class Not : public NonAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Not)
-				virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Not() { kind_ = first_kind; }
+				virtual Value perform(Value const&) override;
 				string_type toString() const { return "!"; }
 			};
 
@@ -62,138 +72,167 @@ public:
 	{
 	public:
 		DEF_POINTER_TYPE(BinaryOperator)
+		DEF_IS_CONVERTIBLE_FROM(BinaryOperator)
 		virtual unsigned numberOfArgs() const override { return 2; }
+		virtual Value perform(Value const& first, Value const& second) = 0;
 	};
 
-		class RAssocOperator : public BinaryOperator {};
+		class RAssocOperator : public BinaryOperator
+		{
+			DEF_IS_CONVERTIBLE_FROM(RAssocOperator)
+		};
 			
 			class Power : public RAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Power)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Power() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "^"; }
 			};
 
-		class LAssocOperator : public BinaryOperator {};
+		class LAssocOperator : public BinaryOperator
+		{
+			DEF_IS_CONVERTIBLE_FROM(LAssocOperator)
+		};
 
 			class Addition : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Addition)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Addition() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "+"; }
 			};
 
 			class Subtraction : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Subtraction)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Subtraction() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "-"; }
 			};
 
 			class Multiplication : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Multiplication)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Multiplication() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "*"; }
 			};
 
 			class Division : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Division)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Division() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "/"; }
 			};
 
 			class Modulus : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Modulus)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Modulus() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "%"; }
 			};
 
 			class And : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(And)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				And() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "and"; }
 			};
 
 			class Nand : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Nand)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Nand() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "nand"; }
 			};
 
 			class Or : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Or)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Or() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "or"; }
 			};
 
 			class Nor : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Nor)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Nor() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "nor"; }
 			};
 
 			class Xor : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Xor)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Xor() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "xor"; }
 			};
 
 			class Xnor : public LAssocOperator
 			{
 				DEF_IS_CONVERTIBLE_FROM(Xnor)
-					virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+				Xnor() { kind_ = first_kind; }
+					virtual Value perform(Value const&, Value const&) override;
 				string_type toString() const { return "xnor"; }
 			};
 
-			class Relational : public LAssocOperator {};
+			class Relational : public LAssocOperator
+			{
+				DEF_IS_CONVERTIBLE_FROM(Relational)
+			};
 
 				class Equality : public Relational
 				{
 					DEF_IS_CONVERTIBLE_FROM(Equality)
-						virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+					Equality() { kind_ = first_kind; }
+						virtual Value perform(Value const&, Value const&) override;
 					string_type toString() const { return "=="; }
 				};
 
 				class Greater : public Relational
 				{
 					DEF_IS_CONVERTIBLE_FROM(Greater)
-						virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+					Greater() { kind_ = first_kind; }
+						virtual Value perform(Value const&, Value const&) override;
 					string_type toString() const { return ">"; }
 				};
 
 				class GreaterEqual : public Relational
 				{
 					DEF_IS_CONVERTIBLE_FROM(GreaterEqual)
-						virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+					GreaterEqual() { kind_ = first_kind; }
+						virtual Value perform(Value const&, Value const&) override;
 					string_type toString() const { return ">="; }
 				};
 
 				class Inequality : public Relational
 				{
 					DEF_IS_CONVERTIBLE_FROM(Inequality)
-						virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+					Inequality() { kind_ = first_kind; }
+						virtual Value perform(Value const&, Value const&) override;
 					string_type toString() const { return "!="; }
 				};
 
 				class Less : public Relational
 				{
 					DEF_IS_CONVERTIBLE_FROM(Less)
-						virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+					Less() { kind_ = first_kind; }
+						virtual Value perform(Value const&, Value const&) override;
 					string_type toString() const { return "<"; }
 				};
 
 				class LessEqual : public Relational
 				{
 					DEF_IS_CONVERTIBLE_FROM(LessEqual)
-						virtual Operand::pointer_type perform(std::stack<Operand::pointer_type>&);
+					LessEqual() { kind_ = first_kind; }
+						virtual Value perform(Value const&, Value const&) override;
 					string_type toString() const { return "=<"; }
 				};
 			
\ No newline at end of file
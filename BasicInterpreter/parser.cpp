@@ -16,6 +16,7 @@
 #include "word.hpp"
 #include "position_tracker.hpp"
 #include <stack>
+#include <vector>
 #include <exception>
 using namespace std;
 
@@ -70,7 +71,7 @@ Parser::stmt_p Parser::classStatement()
 	if (check<Inherits>())
 	{
 		consume<Variable>("Expected superclass name.");
-		super.reset(new VariableExpression(convert<Variable>(previous())));
+		super = arena_.make<VariableExpression>(convert<Variable>(previous()));
 	}
 	
 	consume<LeftBrace>("Expected '{' before class body.");
@@ -133,7 +134,7 @@ Parser::stmt_p Parser::classStatement()
 		
 	consume<RightBrace>("Expected closing brace after class definition.");
 
-	stmt_p clas(new StmtClass(name, super, data, methods));
+	stmt_p clas = arena_.make<StmtClass>(name, super, data, methods);
 	PositionTracker::addStatement(clas);
 	return clas;
 }
@@ -148,7 +149,7 @@ Parser::stmt_p Parser::printStatement()
 {
 	expr_p val = expression();
 	consume<SemiColon>("Expected ';'");
-	stmt_p printer(new StmtPrint(val));
+	stmt_p printer = arena_.make<StmtPrint>(val);
 	PositionTracker::addStatement(printer);
 	return printer;
 }
@@ -168,7 +169,7 @@ Parser::stmt_p Parser::retStatement()
 		val = expression();
 
 	consume<SemiColon>("Expected ';' after return statement.");
-	stmt_p retStmt(new StmtReturn(ret, val));
+	stmt_p retStmt = arena_.make<StmtReturn>(ret, val);
 	PositionTracker::addStatement(retStmt);
 	return retStmt;
 }
@@ -183,7 +184,7 @@ Parser::stmt_p Parser::expStatement()
 {
 	expr_p val = expression();
 	consume<SemiColon>("Expected ';'");
-	stmt_p expr(new StmtExpression(val));
+	stmt_p expr = arena_.make<StmtExpression>(val);
 	PositionTracker::addStatement(expr);
 	return expr;
 }
@@ -228,7 +229,7 @@ Parser::stmt_p Parser::varDeclaration()
 		init = expression();
 
 	consume<SemiColon>("Expected ';'");
-	stmt_p expr(new StmtVariable(convert<Variable>(var), init));
+	stmt_p expr = arena_.make<StmtVariable>(convert<Variable>(var), init);
 	PositionTracker::addStatement(expr);
 	return expr;
 }
@@ -265,7 +266,7 @@ Parser::stmt_p Parser::funcStatement(std::string kind, Variable::pointer_type na
 
 	consume<LeftBracket>("Expected '(' after " + kind + " name");
 	
-	list<Token::pointer_type> params;
+	vector<Token::pointer_type> params;
 	if (!is<RightBracket>(peek()))
 	{
 		do
@@ -293,7 +294,7 @@ Parser::stmt_p Parser::funcStatement(std::string kind, Variable::pointer_type na
 
 	consume<RightBrace>("Expected '}' after " + kind + ".");
 
-	stmt_p func(new StmtFunc(name, params, body));
+	stmt_p func = arena_.make<StmtFunc>(name, params, body);
 	PositionTracker::addStatement(func);
 	return func;
 
@@ -314,9 +315,9 @@ Parser::stmt_p Parser::block()
 
 	consume<RightBrace>("Expected '}'");
 	
-	stmt_p block(new StmtBlock(statements));
+	stmt_p block = arena_.make<StmtBlock>(statements);
 	PositionTracker::addStatement(block);
-	return stmt_p(new StmtBlock(statements));
+	return arena_.make<StmtBlock>(statements);
 }
 
 /**
@@ -337,7 +338,7 @@ Parser::stmt_p Parser::ifStatement()
 	if (check<Else>())
 		elseB = statement();
 		
-	stmt_p ifStmt(new StmtIf(cond, thenB, elseB));
+	stmt_p ifStmt = arena_.make<StmtIf>(cond, thenB, elseB);
 	PositionTracker::addStatement(ifStmt);
 	return ifStmt;
 }
@@ -356,7 +357,7 @@ Parser::stmt_p Parser::whileStatement()
 
 	stmt_p whileB = statement();
 
-	stmt_p whileStmt(new StmtWhile(cond, whileB));
+	stmt_p whileStmt = arena_.make<StmtWhile>(cond, whileB);
 	PositionTracker::addStatement(whileStmt);
 	return whileStmt;
 }
@@ -376,7 +377,7 @@ Parser::stmt_p Parser::doWhileStatement()
 	expr_p cond = expression();
 	consume<RightBracket>("Expected ')' after while condition.");
 
-	stmt_p whileStmt(new StmtDoWhile(cond, whileB));
+	stmt_p whileStmt = arena_.make<StmtDoWhile>(cond, whileB);
 	PositionTracker::addStatement(whileStmt);
 	return whileStmt;
 }
@@ -414,15 +415,15 @@ Parser::stmt_p Parser::forStatement()
 	stmt_p bod = statement();
 
 	if (inc != nullptr)
-		bod.reset(new StmtBlock(stmt_list{bod, stmt_p(new StmtExpression(inc))}));
+		bod = arena_.make<StmtBlock>(stmt_list{bod, arena_.make<StmtExpression>(inc)});
 
 	if (cond == nullptr)
-		cond.reset(new LiteralExpression(Boolean::pointer_type(new Boolean(true))));
+		cond = arena_.make<LiteralExpression>(arena_.make<Boolean>(true));
 
-	bod.reset(new StmtWhile(cond, bod));
+	bod = arena_.make<StmtWhile>(cond, bod);
 
 	if (init != nullptr)
-		bod.reset(new StmtBlock(stmt_list{init, bod}));
+		bod = arena_.make<StmtBlock>(stmt_list{init, bod});
 
 	PositionTracker::addStatement(bod);
 	return bod;
@@ -539,11 +540,11 @@ Parser::expr_p Parser::assignment()
 		expr_p val = assignment();
 
 		if (is<VariableExpression>(exp))
-			return expr_p(new AssignExpression(convert<VariableExpression>(exp)->oper_, val));
+			return arena_.make<AssignExpression>(convert<VariableExpression>(exp)->oper_, val);
 		else if (is<GetExpression>(exp))
 		{
 			GetExpression::pointer_type get = convert<GetExpression>(exp);
-			return expr_p(new SetExpression(get->obj_, get->name_, val));
+			return arena_.make<SetExpression>(get->obj_, get->name_, val);
 		}
 
 		stringstream msg;
@@ -568,7 +569,7 @@ Parser::expr_p Parser::logOr()
 	{
 		Token::pointer_type oper = previous();
 		expr_p right = logAnd();
-		expr.reset(new LogicalExpression(expr, convert<BinaryOperator>(oper), right));
+		expr = arena_.make<LogicalExpression>(expr, convert<BinaryOperator>(oper), right);
 	}
 	
 	return expr;
@@ -588,7 +589,7 @@ Parser::expr_p Parser::logAnd()
 	{
 		Token::pointer_type oper = previous();
 		expr_p right = equality();
-		expr.reset(new LogicalExpression(expr, convert<BinaryOperator>(oper), right));
+		expr = arena_.make<LogicalExpression>(expr, convert<BinaryOperator>(oper), right);
 	}
 
 	return expr;
@@ -609,7 +610,7 @@ Parser::expr_p Parser::equality()
 		advance();
 		Token::pointer_type oper = previous();
 		expr_p right = comparison();
-		exp.reset(new BinaryExpression(exp, convert<BinaryOperator>(oper), right));
+		exp = arena_.make<BinaryExpression>(exp, convert<BinaryOperator>(oper), right);
 	}
 
 	return exp;
@@ -629,7 +630,7 @@ Parser::expr_p Parser::comparison()
 	{
 		Token::pointer_type oper = previous();
 		expr_p right = addition();
-		exp.reset(new BinaryExpression(exp, convert<BinaryOperator>(oper), right));
+		exp = arena_.make<BinaryExpression>(exp, convert<BinaryOperator>(oper), right);
 	}
 
 	return exp;
@@ -649,7 +650,7 @@ Parser::expr_p Parser::addition()
 	{
 		Token::pointer_type oper = previous();
 		expr_p right = multiplication();
-		exp.reset(new BinaryExpression(exp, convert<BinaryOperator>(oper), right));
+		exp = arena_.make<BinaryExpression>(exp, convert<BinaryOperator>(oper), right);
 	}
 
 	return exp;
@@ -669,7 +670,7 @@ Parser::expr_p Parser::multiplication()
 	{
 		Token::pointer_type oper = previous();
 		expr_p right = unary();
-		exp.reset(new BinaryExpression(exp, convert<BinaryOperator>(oper), right));
+		exp = arena_.make<BinaryExpression>(exp, convert<BinaryOperator>(oper), right);
 	}
 
 	return exp;
@@ -687,7 +688,7 @@ Parser::expr_p Parser::unary()
 	{
 		Token::pointer_type oper = previous();
 		expr_p right = unary();
-		return expr_p(new UnaryExpression(convert<UnaryOperator>(oper), right));
+		return arena_.make<UnaryExpression>(convert<UnaryOperator>(oper), right);
 	}
 
 	return call();
@@ -710,7 +711,7 @@ Parser::expr_p Parser::call()
 		else if (check<Dot>())
 		{
 			Variable::pointer_type name = convert<Variable>(consume<Variable>("Expected property name after '.'"));
-			exp.reset(new GetExpression(exp, name));
+			exp = arena_.make<GetExpression>(exp, name);
 		}
 		else
 			break;
@@ -728,33 +729,33 @@ Parser::expr_p Parser::call()
 Parser::expr_p Parser::primary()
 {
 	if (check<False>())
-		return expr_p(new LiteralExpression(LiteralExpression::oper_type(new False())));
+		return arena_.make<LiteralExpression>(arena_.make<False>());
 
 	if (check<True>())
-		return expr_p(new LiteralExpression(LiteralExpression::oper_type(new True())));
+		return arena_.make<LiteralExpression>(arena_.make<True>());
 
 	if (check<Number>() || check<Word>())
-		return expr_p(new LiteralExpression(convert<Operand>(previous())));
+		return arena_.make<LiteralExpression>(convert<Operand>(previous()));
 
 	if (check<Variable>())
-		return expr_p(new VariableExpression(convert<Variable>(previous())));
+		return arena_.make<VariableExpression>(convert<Variable>(previous()));
 
 	if (check<Me>())
-		return expr_p(new MeExpression(Variable::pointer_type(new Variable("me"))));
+		return arena_.make<MeExpression>(arena_.make<Variable>("me"));
 
 	if (check<Super>())
 	{
-		Variable::pointer_type keyword(new Variable("super"));
+		Variable::pointer_type keyword = arena_.make<Variable>("super");
 		consume<Dot>("Expected '.' after 'super'.");
 		Variable::pointer_type method = convert<Variable>(consume<Variable>("Expected superclass method name."));
-		return expr_p(new SuperExpression(keyword, method));
+		return arena_.make<SuperExpression>(keyword, method);
 	}
 
 	if (check<LeftBracket>())
 	{
 		expr_p exp = expression();
 		consume<RightBracket>("Expected ')' after expression");
-		return expr_p(new GroupExpression(exp));
+		return arena_.make<GroupExpression>(exp);
 	}
 
 	throw ParserException("Keyword/operator is missing an operand.");
@@ -768,7 +769,7 @@ Parser::expr_p Parser::primary()
 */
 Parser::expr_p Parser::finishCall(expr_p callee)
 {
-	list<expr_p> args;
+	vector<expr_p> args;
 	
 	if (!isAtEnd() && !is<RightBracket>(peek()))
 	{
@@ -777,5 +778,5 @@ Parser::expr_p Parser::finishCall(expr_p callee)
 		while(check<Comma>());
 	}
 
-	return expr_p(new CallExpression(callee, convert<RightBracket>(consume<RightBracket>("Expected ')' after function call.")), args));
+	return arena_.make<CallExpression>(callee, convert<RightBracket>(consume<RightBracket>("Expected ')' after function call.")), args);
 }
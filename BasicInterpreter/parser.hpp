@@ -8,6 +8,7 @@
 
 #pragma once
 #include "visitor.hpp"
+#include "ast_arena.hpp"
 #include <list>
 
 class Parser
@@ -29,9 +30,10 @@ public:
 private:
 	TokenList inTokens_;
 	unsigned current_;
+	AstArena& arena_;		// owns every node the parser creates
 public:
 	Parser() = delete;
-	Parser(TokenList const& infixTokens) : inTokens_(infixTokens), current_(0) {}
+	Parser(TokenList const& infixTokens, AstArena& arena) : inTokens_(infixTokens), current_(0), arena_(arena) {}
 	stmt_list parse();
 
 private:
@@ -83,10 +83,10 @@ std::string PositionTracker::printPosition()
 /**
 @name:		addToken
 @purpose:	adds a token and its position in the code into tokenPosition_
-@param:		std::shared_ptr<Token>
+@param:		Token::pointer_type
 @return:	void
 */
-void PositionTracker::addToken(std::shared_ptr<Token> token)
+void PositionTracker::addToken(Token::pointer_type token)
 {
 	tokenPosition_.push_back(pair<unsigned, Token::pointer_type>(cursorPosition_, token));
 }
@@ -104,4 +104,20 @@ void PositionTracker::addStatement(Statement::pointer_type stmt)
 	// don't try to reassign cursorPosition_ if we've reached the end of the token list
 	if (itTokPos_ != tokenPosition_.cend())
 		cursorPosition_ = itTokPos_->first;
-}
\ No newline at end of file
+}
+
+/**
+@name:		clear
+@purpose:	forgets the positions of a program whose tokens and statements are about to be freed
+@param:		null
+@return:	void
+*/
+void PositionTracker::clear()
+{
+	tokenPosition_.clear();
+	itTokPos_ = tokenPosition_.cend();
+	stmtPosition_.clear();
+	itStmtPos_ = stmtPosition_.cend();
+	lastExp_.reset();
+	lastTok_.reset();
+}
@@ -41,8 +41,9 @@ public:
 	static short stage_;
 
 	static std::string printPosition();
-	static void addToken(std::shared_ptr<Token> token);
+	static void addToken(Token::pointer_type token);
 	static void addStatement(Statement::pointer_type stmt);
+	static void clear();
 	/*static void getStmtPositionResolver(Statement::pointer_type stmt, unsigned startPos);
 	static void getStmtPositionInterpreter(Statement::pointer_type stmt, unsigned startPos);
 	static unsigned calculateExpOffsetResolver(Expression::pointer_type exp, unsigned startPos);
@@ -0,0 +1,104 @@
+/**	@file ref.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the intrusive reference-counted handle used for tokens and environments
+*/
+
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Holds the count of the Refs that point at an object. An interpreter and everything it creates stay on
+// one thread, so the count is a plain integer rather than the atomic one a std::shared_ptr pays for.
+class RefCounted
+{
+private:
+	mutable std::size_t refs_;
+
+	template <typename T> friend class Ref;
+
+public:
+	RefCounted() : refs_(0) {}
+	RefCounted(RefCounted const&) : refs_(0) {}				// a copy is a new object, with no Refs of its own
+	RefCounted& operator=(RefCounted const&) { return *this; }
+	virtual ~RefCounted() {}
+
+	std::size_t refCount() const { return refs_; }
+
+	// for objects whose storage is owned elsewhere, such as an arena or a pool, which no Ref may delete
+	void makeImmortal() { refs_ = (std::numeric_limits<std::size_t>::max)() / 2; }
+};
+
+template <typename T>
+class Ref
+{
+private:
+	T * ptr_;
+
+	template <typename U> friend class Ref;
+
+public:
+	using element_type = T;
+
+	Ref() : ptr_(nullptr) {}
+	Ref(std::nullptr_t) : ptr_(nullptr) {}
+	explicit Ref(T * ptr) : ptr_(ptr) { retain(); }
+	Ref(Ref const& other) : ptr_(other.ptr_) { retain(); }
+	Ref(Ref&& other) noexcept : ptr_(other.ptr_) { other.ptr_ = nullptr; }
+
+	template <typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+	Ref(Ref<U> const& other) : ptr_(other.ptr_) { retain(); }
+
+	template <typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+	Ref(Ref<U>&& other) noexcept : ptr_(other.ptr_) { other.ptr_ = nullptr; }
+
+	~Ref() { release(); }
+
+	Ref& operator=(Ref const& other) { Ref(other).swap(*this); return *this; }
+	Ref& operator=(Ref&& other) noexcept { Ref(std::move(other)).swap(*this); return *this; }
+	Ref& operator=(std::nullptr_t) { reset(); return *this; }
+
+	void reset() { Ref().swap(*this); }
+	void reset(T * ptr) { Ref(ptr).swap(*this); }
+	void swap(Ref& other) noexcept { std::swap(ptr_, other.ptr_); }
+
+	T * get() const { return ptr_; }
+	T& operator*() const { return *ptr_; }
+	T * operator->() const { return ptr_; }
+	explicit operator bool() const { return ptr_ != nullptr; }
+	std::size_t use_count() const { return ptr_ ? ptr_->refs_ : 0; }
+
+private:
+	void retain() { if (ptr_) ++ptr_->refs_; }
+
+	void release()
+	{
+		if (ptr_ && --ptr_->refs_ == 0)
+			delete ptr_;
+	}
+
+	template <typename To, typename From> friend Ref<To> static_pointer_cast(Ref<From> const& ref);
+};
+
+/**
+@name:		static_pointer_cast
+@purpose:	converts a Ref to a Ref of a derived class, sharing the same object
+@param:		Ref<From> const &
+@return:	Ref<To>
+*/
+template <typename To, typename From>
+Ref<To> static_pointer_cast(Ref<From> const& ref)
+{
+	return Ref<To>(static_cast<To *>(ref.ptr_));
+}
+
+template <typename T, typename U> bool operator==(Ref<T> const& lhs, Ref<U> const& rhs) { return lhs.get() == rhs.get(); }
+template <typename T, typename U> bool operator!=(Ref<T> const& lhs, Ref<U> const& rhs) { return lhs.get() != rhs.get(); }
+template <typename T> bool operator==(Ref<T> const& lhs, std::nullptr_t) { return lhs.get() == nullptr; }
+template <typename T> bool operator==(std::nullptr_t, Ref<T> const& rhs) { return rhs.get() == nullptr; }
+template <typename T> bool operator!=(Ref<T> const& lhs, std::nullptr_t) { return lhs.get() != nullptr; }
+template <typename T> bool operator!=(std::nullptr_t, Ref<T> const& rhs) { return rhs.get() != nullptr; }
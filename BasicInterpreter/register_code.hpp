@@ -0,0 +1,126 @@
+/**	@file register_code.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the instruction set and the compiled form of a program run by the register VM
+*/
+
+#pragma once
+#include "statement.hpp"
+#include "value.hpp"
+#include "inline_cache.hpp"
+#include "bytecode.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Registers are the slots of a call's frame window, the environment its parameters and locals live in,
+// followed by the locals of its blocks that nothing captures and then its temporaries. The script's
+// window is the global environment. An operand marked rk() is a register, or a constant when it has
+// the RK_CONSTANT bit set. Jumps go to the instruction whose index is c, and a conditional jump throws
+// the error of the statement it tests if its condition is not a boolean.
+enum class RegOp : std::uint8_t
+{
+	MOVE,				// a = rk(c)
+	LOAD_NIL,			// a = null
+	GET_ENV,			// a = slot c of the environment b scopes out from the current one
+	SET_ENV,			// slot c of the environment b scopes out from the current one = a
+	GET_GLOBAL,			// a = global c
+	SET_GLOBAL,			// global c = a
+	CHECK_TYPE,			// throws if a cannot be assigned to VarType b
+	BEGIN_SCOPE,		// enters a new environment of c slots for a captured block
+	END_SCOPE,			// returns to the captured block's enclosing environment
+	GET_PROPERTY,		// a = the field or bound method of instance rk(b) at property site c
+	CHECK_INSTANCE,		// throws if a is not an instance
+	SET_PROPERTY,		// the field of instance a at property site c = rk(b)
+	GET_METHOD,			// a = the unbound method of instance rk(b) at property site c and a+1 = the instance,
+						// or a = a callable field and a+1 = null
+	GET_SUPER,			// a = the superclass method named by name b, bound to instance a, super being c scopes out
+
+	// a = rk(b) op rk(c), by the operator's perform()
+	POWER, ADD, SUBTRACT, MULTIPLY, DIVIDE, MODULUS,
+	AND, NAND, OR, NOR, XOR, XNOR,
+	EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL,
+
+	// a = rk(b) op rk(c), for operands declared as numbers, on the int and float fast paths
+	ADD_NUM, SUBTRACT_NUM, MULTIPLY_NUM, DIVIDE_NUM, MODULUS_NUM,
+	EQUAL_NUM, NOT_EQUAL_NUM, GREATER_NUM, GREATER_EQUAL_NUM, LESS_NUM, LESS_EQUAL_NUM,
+
+	// a = op rk(b)
+	FACTORIAL, IDENTITY, NEGATE, NOT,
+	NEGATE_NUM,
+
+	JUMP,				// to c
+	JUMP_IF_FALSE,		// to c if a is false
+	JUMP_IF_TRUE,		// to c if a is true
+
+	// to c if rk(a) op rk(b) holds, or does not hold, for operands declared as numbers
+	JUMP_IF_EQUAL_NUM, JUMP_IF_NOT_EQUAL_NUM, JUMP_IF_GREATER_NUM, JUMP_IF_GREATER_EQUAL_NUM, JUMP_IF_LESS_NUM, JUMP_IF_LESS_EQUAL_NUM,
+	JUMP_UNLESS_EQUAL_NUM, JUMP_UNLESS_NOT_EQUAL_NUM, JUMP_UNLESS_GREATER_NUM, JUMP_UNLESS_GREATER_EQUAL_NUM, JUMP_UNLESS_LESS_NUM, JUMP_UNLESS_LESS_EQUAL_NUM,
+
+	AND_THEN,			// to c if a is false, throws if it is not a boolean
+	OR_ELSE,			// to c if a is true, throws if it is not a boolean
+
+	CHECK_CALLABLE,		// throws if a cannot be called
+	CALL,				// a = a(a+1 .. a+b)
+	INVOKE,				// a = method a called on instance a+1 with a+2 .. a+1+b, or field a called with them if a+1 is null
+	CLOSURE,			// a = function c closed over the current environment
+	INHERIT,			// enters a new environment holding the superclass rk(a) as "super"
+	CLASS,				// a = class c whose methods close over the current environment
+	RETURN,				// returns rk(a) from a function
+	LEAVE,				// returns from a function that reached the end of its body
+	PRINT,				// prints rk(a)
+	NEXT_STATEMENT,		// advances the position tracker past a top-level statement
+	HALT
+};
+
+std::uint16_t const RK_CONSTANT = 0x8000;
+
+struct RegInstruction
+{
+	RegOp op_;
+	bool promote_;			// a is a variable, so a young value written to it leaves the nursery
+	std::uint16_t a_;
+	std::uint16_t b_;
+	Condition cond_;		// the statement a conditional jump tests
+	std::uint32_t c_;
+};
+
+// a property access and the cache of the classes it has seen
+struct PropertySite
+{
+	std::string name_;
+	PropertyCache cache_;
+};
+
+struct RegisterChunk
+{
+	std::vector<RegInstruction> code_;
+	std::vector<Value> constants_;
+	std::vector<std::string> names_;
+	mutable std::vector<PropertySite> sites_;	// caches are filled in as the program runs
+	unsigned registers_;						// size of the frame window
+
+	RegisterChunk() : registers_(0) {}
+};
+
+struct RegisterProto
+{
+	StmtFunc * declaration_;			// owned by the program's AstArena
+	RegisterChunk chunk_;
+};
+
+struct RegisterClass
+{
+	StmtClass * declaration_;
+	std::vector<unsigned> methods_;		// index into RegisterProgram::functions_ of each method, in declaration order
+};
+
+struct RegisterProgram
+{
+	RegisterChunk script_;
+	std::vector<std::unique_ptr<RegisterProto>> functions_;
+	std::vector<RegisterClass> classes_;
+};
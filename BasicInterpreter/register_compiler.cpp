@@ -0,0 +1,1048 @@
+/**	@file register_compiler.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of RegisterCompiler class
+*/
+
+#include "register_compiler.hpp"
+#include <algorithm>
+#include <limits>
+using namespace std;
+
+// destination of an assignment or property store whose value nothing reads
+static unsigned const DISCARD = (numeric_limits<unsigned>::max)();
+
+/**
+@name:		unwrap
+@purpose:	returns the expression inside any number of parentheses
+@param:		Expression::expr_type const &
+@return:	Expression *
+*/
+static Expression * unwrap(Expression::expr_type const& expr)
+{
+	Expression * inner = expr.get();
+	while (is<GroupExpression>(inner))
+		inner = static_cast<GroupExpression*>(inner)->expr_.get();
+	return inner;
+}
+
+/**
+@name:		pure
+@purpose:	returns true if evaluating an expression cannot change a variable, so an operand read before it may stay in its register
+@param:		Expression::expr_type const &
+@return:	bool
+*/
+static bool pure(Expression::expr_type const& expr)
+{
+	Expression * inner = unwrap(expr);
+
+	if (is<BinaryExpression>(inner))
+	{
+		BinaryExpression * binary = static_cast<BinaryExpression*>(inner);
+		return pure(binary->left_) && pure(binary->right_);
+	}
+	if (is<LogicalExpression>(inner))
+	{
+		LogicalExpression * logical = static_cast<LogicalExpression*>(inner);
+		return pure(logical->left_) && pure(logical->right_);
+	}
+	if (is<UnaryExpression>(inner))
+		return pure(static_cast<UnaryExpression*>(inner)->exp_);
+	if (is<GetExpression>(inner))
+		return pure(static_cast<GetExpression*>(inner)->obj_);
+
+	return !is<AssignExpression>(inner) && !is<CallExpression>(inner) && !is<SetExpression>(inner);
+}
+
+/**
+@name:		isComparison
+@purpose:	returns true if the operator compares its operands
+@param:		TokenKind
+@return:	bool
+*/
+static bool isComparison(TokenKind kind)
+{
+	switch (kind)
+	{
+	case TokenKind::Equality:
+	case TokenKind::Inequality:
+	case TokenKind::Greater:
+	case TokenKind::GreaterEqual:
+	case TokenKind::Less:
+	case TokenKind::LessEqual:
+		return true;
+	default:
+		return false;
+	}
+}
+
+RegisterCompiler::RegisterCompiler() : program_(nullptr), chunk_(nullptr), function_(0), next_(0), floor_(0), dst_(DISCARD), number_(false) {}
+
+/**
+@name:		compile
+@purpose:	compiles a resolved program, the statements must have been through the Resolver first, and
+			globalSlots is the size of the global environment before the program declares anything
+@param:		std::list<Statement::pointer_type> const &, unsigned
+@return:	std::unique_ptr<RegisterProgram>
+*/
+std::unique_ptr<RegisterProgram> RegisterCompiler::compile(std::list<Statement::pointer_type> const& statements, unsigned globalSlots)
+{
+	std::unique_ptr<RegisterProgram> program(new RegisterProgram());
+	program_ = &*program;
+	chunk_ = &program->script_;
+	scopes_.clear();
+	function_ = 0;
+
+	// the script's registers are the global slots, so its temporaries start after the last declaration
+	unsigned globals = globalSlots;
+	globalNumbers_.assign(globalSlots, false);
+	for (auto const& statement : statements)
+	{
+		unsigned slot;
+		if (is<StmtVariable>(statement))
+			slot = static_cast<StmtVariable*>(statement.get())->slot_;
+		else if (is<StmtFunc>(statement))
+			slot = static_cast<StmtFunc*>(statement.get())->slot_;
+		else if (is<StmtClass>(statement))
+			slot = static_cast<StmtClass*>(statement.get())->slot_;
+		else
+			continue;
+
+		globals = (std::max)(globals, slot + 1);
+		globalNumbers_.resize(globals, false);
+		if (is<StmtVariable>(statement))
+			globalNumbers_[slot] = static_cast<StmtVariable*>(statement.get())->var_->getType() == VarType::NUMBER;
+	}
+
+	if (globals > RK_CONSTANT)
+		throw CompilerException("CompilerException: Too many registers in one function.");
+
+	next_ = floor_ = globals;
+	chunk_->registers_ = globals;
+
+	for (auto const& statement : statements)
+	{
+		compile(statement);
+		emit(RegOp::NEXT_STATEMENT);
+	}
+
+	emit(RegOp::HALT);
+
+	program_ = nullptr;
+	chunk_ = nullptr;
+	return program;
+}
+
+/**
+@name:		compile
+@purpose:	compiles a single statement, whose temporaries are free again once it is done
+@param:		Statement::pointer_type const &
+@return:	void
+*/
+void RegisterCompiler::compile(Statement::pointer_type const& statement)
+{
+	unsigned floor = floor_;
+	floor_ = next_;
+
+	statement->accept(*this);
+
+	next_ = floor_;
+	floor_ = floor;
+}
+
+/**
+@name:		compileStatements
+@purpose:	compiles a list of statements
+@param:		std::list<Statement::pointer_type> const &
+@return:	void
+*/
+void RegisterCompiler::compileStatements(std::list<Statement::pointer_type> const& statements)
+{
+	for (auto const& statement : statements)
+		compile(statement);
+}
+
+/**
+@name:		compile
+@purpose:	compiles an expression that leaves its value in a register, and returns true if it was declared to give a number
+@param:		Expression::expr_type const &, unsigned
+@return:	bool
+*/
+bool RegisterCompiler::compile(Expression::expr_type const& expr, unsigned dst)
+{
+	unsigned parDst = dst_;
+	unsigned mark = next_;
+	dst_ = dst;
+	number_ = false;
+
+	expr->accept(*this);
+
+	next_ = mark;
+	dst_ = parDst;
+	return number_;
+}
+
+/**
+@name:		direct
+@purpose:	finds an operand that needs no instruction, a literal or a variable kept in a register
+@param:		Expression::expr_type const &, unsigned &, bool &
+@return:	bool
+*/
+bool RegisterCompiler::direct(Expression::expr_type const& expr, unsigned & rk, bool & number)
+{
+	Expression * inner = unwrap(expr);
+
+	if (is<LiteralExpression>(inner))
+	{
+		Value const& val = static_cast<LiteralExpression*>(inner)->value_;
+		number = val.isNumber();
+		rk = addConstant(val) | RK_CONSTANT;
+		return true;
+	}
+
+	if (is<VariableExpression>(inner))
+	{
+		VariableExpression * var = static_cast<VariableExpression*>(inner);
+		Location loc = locate(var->depth_, var->slot_, var->global_, number);
+		if (loc.kind_ == Location::Kind::REGISTER)
+		{
+			rk = loc.index_;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+@name:		operand
+@purpose:	returns the rk() operand for an expression, compiling it into a new temporary unless it needs no instruction
+@param:		Expression::expr_type const &, bool &
+@return:	unsigned
+*/
+unsigned RegisterCompiler::operand(Expression::expr_type const& expr, bool & number)
+{
+	unsigned rk;
+	if (direct(expr, rk, number))
+		return rk;
+
+	return temporary(expr, number);
+}
+
+/**
+@name:		temporary
+@purpose:	compiles an expression into a new temporary, used for an operand that a later one could change
+@param:		Expression::expr_type const &, bool &
+@return:	unsigned
+*/
+unsigned RegisterCompiler::temporary(Expression::expr_type const& expr, bool & number)
+{
+	unsigned reg = allocate();
+	number = compile(expr, reg);
+	return reg;
+}
+
+/**
+@name:		compileFunction
+@purpose:	compiles a function's body into its own chunk, whose window starts with "me" for a method, then the parameters
+@param:		StmtFunc *, bool
+@return:	unsigned - the function's index in the program
+*/
+unsigned RegisterCompiler::compileFunction(StmtFunc * func, bool method)
+{
+	if (program_->functions_.size() > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Too many functions in one program.");
+
+	unsigned index = static_cast<unsigned>(program_->functions_.size());
+	program_->functions_.emplace_back(new RegisterProto());
+	RegisterProto * proto = &*program_->functions_.back();
+	proto->declaration_ = func;
+
+	RegisterChunk * parChunk = chunk_;
+	unsigned parNext = next_, parFloor = floor_, parDst = dst_;
+	chunk_ = &proto->chunk_;
+	++function_;
+
+	Scope scope{ function_, true, true, 0, vector<bool>(func->numSlots_, false) };
+	unsigned slot = method ? 1 : 0;
+	for (auto const& param : func->params_)
+		scope.numbers_[slot++] = static_cast<Variable *>(param.get())->getType() == VarType::NUMBER;
+	scopes_.push_back(std::move(scope));
+
+	if (func->numSlots_ > RK_CONSTANT)
+		throw CompilerException("CompilerException: Too many registers in one function.");
+
+	next_ = floor_ = func->numSlots_;
+	chunk_->registers_ = func->numSlots_;
+
+	compileStatements(func->body_);
+	emit(RegOp::LEAVE);
+
+	scopes_.pop_back();
+	--function_;
+	chunk_ = parChunk;
+	next_ = parNext;
+	floor_ = parFloor;
+	dst_ = parDst;
+	return index;
+}
+
+/**
+@name:		locate
+@purpose:	finds where a resolved variable is kept from the code being compiled
+@param:		unsigned, unsigned, bool, bool &
+@return:	Location
+*/
+RegisterCompiler::Location RegisterCompiler::locate(unsigned depth, unsigned slot, bool global, bool & number) const
+{
+	if (global)
+	{
+		number = slot < globalNumbers_.size() && globalNumbers_[slot];
+		if (function_ == 0)
+			return Location{ Location::Kind::REGISTER, 0, slot };
+		return Location{ Location::Kind::GLOBAL, 0, slot };
+	}
+
+	size_t at = scopes_.size() - 1 - depth;
+	Scope const& scope = scopes_[at];
+	number = slot < scope.numbers_.size() && scope.numbers_[slot];
+
+	if (scope.window_ && scope.function_ == function_)
+		return Location{ Location::Kind::REGISTER, 0, scope.base_ + slot };
+
+	// the scopes flattened into a window have no environment of their own to step over
+	unsigned hops = 0;
+	for (size_t i = at + 1; i < scopes_.size(); ++i)
+		if (scopes_[i].environment_)
+			++hops;
+
+	return Location{ Location::Kind::ENVIRONMENT, hops, slot };
+}
+
+/**
+@name:		declaration
+@purpose:	finds where a variable declared in the innermost scope is kept
+@param:		unsigned
+@return:	Location
+*/
+RegisterCompiler::Location RegisterCompiler::declaration(unsigned slot) const
+{
+	// a top-level declaration is a global, which the script keeps in its registers
+	if (scopes_.empty())
+		return Location{ Location::Kind::REGISTER, 0, slot };
+
+	bool number;
+	return locate(0, slot, false, number);
+}
+
+/**
+@name:		load
+@purpose:	copies a variable into a register
+@param:		Location const &, unsigned
+@return:	void
+*/
+void RegisterCompiler::load(Location const& loc, unsigned dst)
+{
+	switch (loc.kind_)
+	{
+	case Location::Kind::REGISTER:
+		if (loc.index_ != dst)
+			emit(RegOp::MOVE, dst, 0, loc.index_);
+		break;
+	case Location::Kind::ENVIRONMENT:
+		emit(RegOp::GET_ENV, dst, loc.depth_, loc.index_);
+		break;
+	case Location::Kind::GLOBAL:
+		emit(RegOp::GET_GLOBAL, dst, 0, loc.index_);
+		break;
+	}
+}
+
+/**
+@name:		store
+@purpose:	compiles a value into a variable, checking its type if asked, and copies it to dst unless nothing reads it;
+			returns true if the value was declared to give a number
+@param:		Location const &, Expression::expr_type const &, bool, VarType, unsigned
+@return:	bool
+*/
+bool RegisterCompiler::store(Location const& loc, Expression::expr_type const& expr, bool check, VarType type, unsigned dst)
+{
+	// most values are computed straight into a variable's register, but and/or writes its left side before it
+	// reads the right one, which may be the variable itself
+	unsigned reg = loc.kind_ == Location::Kind::REGISTER && !is<LogicalExpression>(unwrap(expr)) ? loc.index_ : allocate();
+	bool number = compile(expr, reg);
+
+	if (check)
+		emit(RegOp::CHECK_TYPE, reg, static_cast<unsigned>(type));
+
+	if (loc.kind_ == Location::Kind::REGISTER && reg != loc.index_)
+		emit(RegOp::MOVE, loc.index_, 0, reg);
+	else if (loc.kind_ == Location::Kind::ENVIRONMENT)
+		emit(RegOp::SET_ENV, reg, loc.depth_, loc.index_);
+	else if (loc.kind_ == Location::Kind::GLOBAL)
+		emit(RegOp::SET_GLOBAL, reg, 0, loc.index_);
+
+	if (dst != DISCARD && dst != reg)
+		emit(RegOp::MOVE, dst, 0, reg);
+
+	return number;
+}
+
+/**
+@name:		declareNumber
+@purpose:	records whether a variable of the innermost scope was declared as a number
+@param:		unsigned, bool
+@return:	void
+*/
+void RegisterCompiler::declareNumber(unsigned slot, bool number)
+{
+	// global slots were recorded before the script was compiled
+	if (scopes_.empty())
+		return;
+
+	vector<bool> & numbers = scopes_.back().numbers_;
+	if (slot >= numbers.size())
+		numbers.resize(slot + 1, false);
+	numbers[slot] = number;
+}
+
+/**
+@name:		branch
+@purpose:	compiles a statement's condition and a jump taken when it is the given value, whose target is patched later;
+			a comparison of two numbers is tested by the jump itself
+@param:		Expression::expr_type const &, bool, Condition
+@return:	std::size_t - index of the jump
+*/
+std::size_t RegisterCompiler::branch(Expression::expr_type const& cond, bool when, Condition kind)
+{
+	unsigned mark = next_;
+	Expression * inner = unwrap(cond);
+	size_t at;
+
+	if (is<BinaryExpression>(inner) && isComparison(static_cast<BinaryExpression*>(inner)->oper_->kind()))
+	{
+		BinaryExpression * binary = static_cast<BinaryExpression*>(inner);
+		bool leftNumber, rightNumber;
+		unsigned left = pure(binary->right_) ? operand(binary->left_, leftNumber) : temporary(binary->left_, leftNumber);
+		unsigned right = operand(binary->right_, rightNumber);
+
+		if (leftNumber && rightNumber)
+		{
+			// JUMP_UNLESS_* follows JUMP_IF_* in the same order
+			RegOp op;
+			switch (binary->oper_->kind())
+			{
+			case TokenKind::Equality:		op = RegOp::JUMP_IF_EQUAL_NUM; break;
+			case TokenKind::Inequality:		op = RegOp::JUMP_IF_NOT_EQUAL_NUM; break;
+			case TokenKind::Greater:		op = RegOp::JUMP_IF_GREATER_NUM; break;
+			case TokenKind::GreaterEqual:	op = RegOp::JUMP_IF_GREATER_EQUAL_NUM; break;
+			case TokenKind::Less:			op = RegOp::JUMP_IF_LESS_NUM; break;
+			default:						op = RegOp::JUMP_IF_LESS_EQUAL_NUM; break;
+			}
+			if (!when)
+				op = static_cast<RegOp>(static_cast<unsigned>(op) + (static_cast<unsigned>(RegOp::JUMP_UNLESS_EQUAL_NUM) - static_cast<unsigned>(RegOp::JUMP_IF_EQUAL_NUM)));
+
+			at = emit(op, left, right);
+			chunk_->code_[at].cond_ = kind;
+			next_ = mark;
+			return at;
+		}
+
+		unsigned reg = allocate();
+		switch (binary->oper_->kind())
+		{
+		case TokenKind::Equality:		emit(RegOp::EQUAL, reg, left, right); break;
+		case TokenKind::Inequality:		emit(RegOp::NOT_EQUAL, reg, left, right); break;
+		case TokenKind::Greater:		emit(RegOp::GREATER, reg, left, right); break;
+		case TokenKind::GreaterEqual:	emit(RegOp::GREATER_EQUAL, reg, left, right); break;
+		case TokenKind::Less:			emit(RegOp::LESS, reg, left, right); break;
+		default:						emit(RegOp::LESS_EQUAL, reg, left, right); break;
+		}
+
+		at = emit(when ? RegOp::JUMP_IF_TRUE : RegOp::JUMP_IF_FALSE, reg);
+		chunk_->code_[at].cond_ = kind;
+		next_ = mark;
+		return at;
+	}
+
+	bool number;
+	unsigned reg = operand(cond, number);
+	if (reg & RK_CONSTANT)
+	{
+		unsigned constant = reg;
+		reg = allocate();
+		emit(RegOp::MOVE, reg, 0, constant);
+	}
+
+	at = emit(when ? RegOp::JUMP_IF_TRUE : RegOp::JUMP_IF_FALSE, reg);
+	chunk_->code_[at].cond_ = kind;
+	next_ = mark;
+	return at;
+}
+
+/**
+@name:		visit
+@purpose:	compiles an assignment into the variable, checking the declared type unless it is proven
+@param:		AssignExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(AssignExpression * expr)
+{
+	bool number;
+	Location loc = locate(expr->depth_, expr->slot_, expr->global_, number);
+	number_ = store(loc, expr->expr_, !expr->checked_, expr->oper_->getType(), dst_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the operator's instruction on its two operands, a typed one if both were declared as numbers
+@param:		BinaryExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(BinaryExpression * expr)
+{
+	bool leftNumber, rightNumber;
+	unsigned left = pure(expr->right_) ? operand(expr->left_, leftNumber) : temporary(expr->left_, leftNumber);
+	unsigned right = operand(expr->right_, rightNumber);
+	bool numbers = leftNumber && rightNumber;
+
+	RegOp op;
+	switch (expr->oper_->kind())
+	{
+	case TokenKind::Power:			op = RegOp::POWER; break;
+	case TokenKind::Addition:		op = numbers ? RegOp::ADD_NUM : RegOp::ADD; break;
+	case TokenKind::Subtraction:	op = numbers ? RegOp::SUBTRACT_NUM : RegOp::SUBTRACT; break;
+	case TokenKind::Multiplication:	op = numbers ? RegOp::MULTIPLY_NUM : RegOp::MULTIPLY; break;
+	case TokenKind::Division:		op = numbers ? RegOp::DIVIDE_NUM : RegOp::DIVIDE; break;
+	case TokenKind::Modulus:		op = numbers ? RegOp::MODULUS_NUM : RegOp::MODULUS; break;
+	case TokenKind::And:			op = RegOp::AND; break;
+	case TokenKind::Nand:			op = RegOp::NAND; break;
+	case TokenKind::Or:				op = RegOp::OR; break;
+	case TokenKind::Nor:			op = RegOp::NOR; break;
+	case TokenKind::Xor:			op = RegOp::XOR; break;
+	case TokenKind::Xnor:			op = RegOp::XNOR; break;
+	case TokenKind::Equality:		op = numbers ? RegOp::EQUAL_NUM : RegOp::EQUAL; break;
+	case TokenKind::Inequality:		op = numbers ? RegOp::NOT_EQUAL_NUM : RegOp::NOT_EQUAL; break;
+	case TokenKind::Greater:		op = numbers ? RegOp::GREATER_NUM : RegOp::GREATER; break;
+	case TokenKind::GreaterEqual:	op = numbers ? RegOp::GREATER_EQUAL_NUM : RegOp::GREATER_EQUAL; break;
+	case TokenKind::Less:			op = numbers ? RegOp::LESS_NUM : RegOp::LESS; break;
+	case TokenKind::LessEqual:		op = numbers ? RegOp::LESS_EQUAL_NUM : RegOp::LESS_EQUAL; break;
+	default:
+		throw CompilerException("The operator <" + expr->oper_->toString() + "> is not a binary operator.");
+	}
+
+	emit(op, dst_, left, right);
+	number_ = numbers && !isComparison(expr->oper_->kind());
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	lays out the callee, checked before any argument runs, and the arguments in consecutive registers, then calls
+@param:		CallExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(CallExpression * expr)
+{
+	// the call can be laid out from the destination when it is the newest temporary
+	bool inPlace = dst_ >= floor_ && dst_ + 1 == next_;
+	unsigned base = inPlace ? dst_ : allocate();
+	bool number;
+
+	// obj.m(args) leaves the method and its receiver in the first two registers rather than a bound method
+	bool invoke = is<GetExpression>(expr->callee_);
+	if (invoke)
+	{
+		GetExpression * get = static_cast<GetExpression*>(expr->callee_.get());
+		unsigned receiver = allocate();
+		unsigned obj;
+		if (!direct(get->obj_, obj, number))
+		{
+			compile(get->obj_, receiver);
+			obj = receiver;
+		}
+		emit(RegOp::GET_METHOD, base, obj, addSite(get->name_->getName()));
+	}
+	else
+	{
+		compile(expr->callee_, base);
+		if (!expr->args_.empty())
+			emit(RegOp::CHECK_CALLABLE, base);
+	}
+
+	for (auto const& arg : expr->args_)
+		compile(arg, allocate());
+
+	emit(invoke ? RegOp::INVOKE : RegOp::CALL, base, static_cast<unsigned>(expr->args_.size()));
+	if (base != dst_)
+		emit(RegOp::MOVE, dst_, 0, base);
+
+	number_ = false;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the operator's instruction on its operand, a typed one for the negation of a number
+@param:		UnaryExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(UnaryExpression * expr)
+{
+	bool number;
+	unsigned exp = operand(expr->exp_, number);
+
+	switch (expr->oper_->kind())
+	{
+	case TokenKind::Factorial:	emit(RegOp::FACTORIAL, dst_, exp); break;
+	case TokenKind::Identity:	emit(RegOp::IDENTITY, dst_, exp); break;
+	case TokenKind::Negation:	emit(number ? RegOp::NEGATE_NUM : RegOp::NEGATE, dst_, exp); break;
+	case TokenKind::Not:		emit(RegOp::NOT, dst_, exp); break;
+	default:
+		throw CompilerException("The operator <" + expr->oper_->toString() + "> is not a unary operator.");
+	}
+
+	number_ = number && expr->oper_->kind() != TokenKind::Not;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the grouped expression
+@param:		GroupExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(GroupExpression * expr)
+{
+	number_ = compile(expr->expr_, dst_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	copies the literal from the constant pool
+@param:		LiteralExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(LiteralExpression * expr)
+{
+	if (expr->value_.isNil())
+		emit(RegOp::LOAD_NIL, dst_);
+	else
+		emit(RegOp::MOVE, dst_, 0, addConstant(expr->value_) | RK_CONSTANT);
+
+	number_ = expr->value_.isNumber();
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles a short-circuiting and/or, the right side is skipped when the left decides the result
+@param:		LogicalExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(LogicalExpression * expr)
+{
+	compile(expr->left_, dst_);
+	size_t jump = emit(is<Or>(expr->oper_) ? RegOp::OR_ELSE : RegOp::AND_THEN, dst_);
+	compile(expr->right_, dst_);
+	patch(jump);
+	number_ = false;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	reads a variable from its register, environment or global slot
+@param:		VariableExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(VariableExpression * expr)
+{
+	bool number;
+	load(locate(expr->depth_, expr->slot_, expr->global_, number), dst_);
+	number_ = number;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the object and reads one of its properties
+@param:		GetExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(GetExpression * expr)
+{
+	bool number;
+	unsigned obj = operand(expr->obj_, number);
+	emit(RegOp::GET_PROPERTY, dst_, obj, addSite(expr->name_->getName()));
+	number_ = false;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles the object, checked before the value runs, then the value and the store
+@param:		SetExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(SetExpression * expr)
+{
+	bool number;
+	unsigned obj;
+	if (!pure(expr->val_) || !direct(expr->obj_, obj, number) || (obj & RK_CONSTANT))
+		obj = temporary(expr->obj_, number);
+
+	emit(RegOp::CHECK_INSTANCE, obj);
+	unsigned val = operand(expr->val_, number);
+	emit(RegOp::SET_PROPERTY, obj, val, addSite(expr->name_->getName()));
+
+	if (dst_ != DISCARD)
+		emit(RegOp::MOVE, dst_, 0, val);
+	number_ = false;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	reads "me", the first slot of the method's window
+@param:		MeExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(MeExpression * expr)
+{
+	bool number;
+	load(locate(expr->depth_, 0, false, number), dst_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	looks up a superclass method, bound to the "me" one scope below super
+@param:		SuperExpression *
+@return:	Value
+*/
+Value RegisterCompiler::visit(SuperExpression * expr)
+{
+	bool number;
+	load(locate(expr->depth_ - 1, 0, false, number), dst_);
+
+	Location super = locate(expr->depth_, 0, false, number);
+	emit(RegOp::GET_SUPER, dst_, addName(expr->method_->getName()), super.depth_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	compiles an expression whose value is not kept
+@param:		StmtExpression *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtExpression * expr)
+{
+	if (is<AssignExpression>(expr->expr_) || is<SetExpression>(expr->expr_))
+		compile(expr->expr_, DISCARD);
+	else
+		compile(expr->expr_, allocate());
+}
+
+/**
+@name:		visit
+@purpose:	compiles a function's body and stores a closure over the current environment in its variable
+@param:		StmtFunc *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtFunc * expr)
+{
+	unsigned index = compileFunction(expr, false);
+	Location loc = declaration(expr->slot_);
+
+	if (loc.kind_ == Location::Kind::REGISTER)
+		emit(RegOp::CLOSURE, loc.index_, 0, index);
+	else
+	{
+		unsigned reg = allocate();
+		emit(RegOp::CLOSURE, reg, 0, index);
+		emit(RegOp::SET_ENV, reg, loc.depth_, loc.index_);
+	}
+
+	declareNumber(expr->slot_, false);
+}
+
+/**
+@name:		visit
+@purpose:	compiles the expression to print
+@param:		StmtPrint *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtPrint * expr)
+{
+	bool number;
+	emit(RegOp::PRINT, operand(expr->expr_, number));
+}
+
+/**
+@name:		visit
+@purpose:	compiles a return, the returned value is checked against the function's type when it runs
+@param:		StmtReturn *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtReturn * expr)
+{
+	bool number;
+	if (expr->expr_ != nullptr)
+		emit(RegOp::RETURN, operand(expr->expr_, number));
+	else
+		emit(RegOp::RETURN, addConstant(Value()) | RK_CONSTANT);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a variable's initializer into the variable, or clears it, since a flattened block's
+			variables are reused by every pass of a loop
+@param:		StmtVariable *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtVariable * expr)
+{
+	VarType type = expr->var_->getType();
+	Location loc = declaration(expr->slot_);
+
+	if (expr->expr_ != nullptr)
+		store(loc, expr->expr_, !expr->checked_, type, DISCARD);
+	else if (loc.kind_ == Location::Kind::REGISTER)
+		emit(RegOp::LOAD_NIL, loc.index_);
+	else
+	{
+		unsigned reg = allocate();
+		emit(RegOp::LOAD_NIL, reg);
+		emit(RegOp::SET_ENV, reg, loc.depth_, loc.index_);
+	}
+
+	declareNumber(expr->slot_, type == VarType::NUMBER);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a block, whose variables become registers of the window unless a closure captures them
+@param:		StmtBlock *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtBlock * expr)
+{
+	if (expr->numSlots_ == 0)
+	{
+		compileStatements(expr->statements_);
+		return;
+	}
+
+	if (expr->captured_)
+	{
+		emit(RegOp::BEGIN_SCOPE, 0, 0, expr->numSlots_);
+		scopes_.push_back(Scope{ function_, false, true, 0, {} });
+		compileStatements(expr->statements_);
+		scopes_.pop_back();
+		emit(RegOp::END_SCOPE);
+		return;
+	}
+
+	unsigned base = next_;
+	for (unsigned i = 0; i < expr->numSlots_; ++i)
+		allocate();
+
+	scopes_.push_back(Scope{ function_, true, false, base, {} });
+	compileStatements(expr->statements_);
+	scopes_.pop_back();
+	next_ = base;
+}
+
+/**
+@name:		visit
+@purpose:	compiles a class's methods, within the scope of super if it has one, and stores the class in its variable
+@param:		StmtClass *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtClass * expr)
+{
+	if (program_->classes_.size() > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Too many classes in one program.");
+
+	RegisterClass proto;
+	proto.declaration_ = expr;
+
+	if (expr->super_ != nullptr)
+		scopes_.push_back(Scope{ function_, false, true, 0, {} });
+
+	for (auto const& method : expr->methods_)
+		proto.methods_.push_back(compileFunction(method.get(), true));
+
+	if (expr->super_ != nullptr)
+	{
+		scopes_.pop_back();
+
+		bool number;
+		emit(RegOp::INHERIT, operand(expr->super_, number));
+	}
+
+	Location loc = declaration(expr->slot_);
+	unsigned reg = loc.kind_ == Location::Kind::REGISTER ? loc.index_ : allocate();
+	emit(RegOp::CLASS, reg, 0, static_cast<unsigned>(program_->classes_.size()));
+	if (loc.kind_ != Location::Kind::REGISTER)
+		emit(RegOp::SET_ENV, reg, loc.depth_, loc.index_);
+
+	program_->classes_.push_back(proto);
+	declareNumber(expr->slot_, false);
+}
+
+/**
+@name:		visit
+@purpose:	compiles an if-statement as a conditional jump over the then block
+@param:		StmtIf *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtIf * expr)
+{
+	size_t elseJump = branch(expr->expr_, false, Condition::IF);
+	compile(expr->thenBlock_);
+
+	if (expr->elseBlock_ == nullptr)
+	{
+		patch(elseJump);
+		return;
+	}
+
+	size_t endJump = emit(RegOp::JUMP);
+	patch(elseJump);
+	compile(expr->elseBlock_);
+	patch(endJump);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a while-statement with its condition at the bottom, entered by a jump to the first test
+@param:		StmtWhile *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtWhile * expr)
+{
+	size_t entry = emit(RegOp::JUMP);
+	size_t start = chunk_->code_.size();
+	compile(expr->whileBlock_);
+	patch(entry);
+
+	size_t loop = branch(expr->expr_, true, Condition::WHILE);
+	chunk_->code_[loop].c_ = static_cast<uint32_t>(start);
+}
+
+/**
+@name:		visit
+@purpose:	compiles a do while-statement, the condition is tested after each pass
+@param:		StmtDoWhile *
+@return:	void
+*/
+void RegisterCompiler::visit(StmtDoWhile * expr)
+{
+	size_t start = chunk_->code_.size();
+	compile(expr->whileBlock_);
+
+	size_t loop = branch(expr->expr_, true, Condition::DO_WHILE);
+	chunk_->code_[loop].c_ = static_cast<uint32_t>(start);
+}
+
+/**
+@name:		allocate
+@purpose:	takes the next free register of the window, which grows to fit
+@param:		null
+@return:	unsigned
+*/
+unsigned RegisterCompiler::allocate()
+{
+	if (next_ >= RK_CONSTANT)
+		throw CompilerException("CompilerException: Too many registers in one function.");
+
+	unsigned reg = next_++;
+	chunk_->registers_ = (std::max)(chunk_->registers_, next_);
+	return reg;
+}
+
+/**
+@name:		emit
+@purpose:	writes an instruction and returns its index
+@param:		RegOp, unsigned, unsigned, unsigned
+@return:	std::size_t
+*/
+std::size_t RegisterCompiler::emit(RegOp op, unsigned a, unsigned b, unsigned c)
+{
+	if (a > (numeric_limits<uint16_t>::max)() || b > (numeric_limits<uint16_t>::max)())
+		throw CompilerException("CompilerException: Operand is too large for an instruction.");
+
+	// the registers below the statement's temporaries are variables
+	chunk_->code_.push_back(RegInstruction{ op, a < floor_, static_cast<uint16_t>(a), static_cast<uint16_t>(b), Condition::IF, c });
+	return chunk_->code_.size() - 1;
+}
+
+/**
+@name:		patch
+@purpose:	points a forward jump at the next instruction to be written
+@param:		std::size_t
+@return:	void
+*/
+void RegisterCompiler::patch(std::size_t at)
+{
+	chunk_->code_[at].c_ = static_cast<uint32_t>(chunk_->code_.size());
+}
+
+/**
+@name:		addConstant
+@purpose:	adds a value to the current chunk's constant pool, reusing an earlier boolean or small integer that is the same
+@param:		Value const &
+@return:	unsigned - the constant's index
+*/
+unsigned RegisterCompiler::addConstant(Value const& val)
+{
+	auto& constants = chunk_->constants_;
+	for (size_t i = 0; i < constants.size(); ++i)
+	{
+		Value const& other = constants[i];
+		if ((val.isBool() && other.isBool() && val.asBool() == other.asBool()) ||
+			(val.isSmallInt() && other.isSmallInt() && val.asSmallInt() == other.asSmallInt()))
+			return static_cast<unsigned>(i);
+	}
+
+	constants.push_back(val);
+	if (constants.size() > RK_CONSTANT)
+		throw CompilerException("CompilerException: Too many constants in one chunk.");
+
+	return static_cast<unsigned>(constants.size() - 1);
+}
+
+/**
+@name:		addName
+@purpose:	adds a method name to the current chunk, reusing an existing entry
+@param:		std::string const &
+@return:	unsigned - the name's index
+*/
+unsigned RegisterCompiler::addName(std::string const& name)
+{
+	for (size_t i = 0; i < chunk_->names_.size(); ++i)
+		if (chunk_->names_[i] == name)
+			return static_cast<unsigned>(i);
+
+	chunk_->names_.push_back(name);
+	return static_cast<unsigned>(chunk_->names_.size() - 1);
+}
+
+/**
+@name:		addSite
+@purpose:	adds a property access, with its own inline cache, to the current chunk
+@param:		std::string const &
+@return:	unsigned - the site's index
+*/
+unsigned RegisterCompiler::addSite(std::string const& name)
+{
+	chunk_->sites_.push_back(PropertySite{ name, PropertyCache() });
+	return static_cast<unsigned>(chunk_->sites_.size() - 1);
+}
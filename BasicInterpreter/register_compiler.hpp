@@ -0,0 +1,104 @@
+/**	@file register_compiler.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the register compiler, which lowers resolved statements into register code
+*/
+
+#pragma once
+#include "visitor.hpp"
+#include "register_code.hpp"
+#include "bytecode.hpp"
+#include <list>
+#include <string>
+#include <vector>
+
+class RegisterCompiler : public ExprVisitor, public StmtVisitor
+{
+public:
+	class CompilerException : public std::exception
+	{
+	public:
+		CompilerException(std::string msg) : std::exception(msg.c_str()) {}
+	};
+private:
+	// a scope the resolver counted, and where its variables are kept at run time
+	struct Scope
+	{
+		unsigned function_;			// nesting depth of the function whose code it belongs to
+		bool window_;				// its variables are registers of that function's frame window, from base_
+		bool environment_;			// it has an environment at run time, on the chain closures reach outer variables by
+		unsigned base_;
+		std::vector<bool> numbers_;	// each slot was declared as a number
+	};
+
+	// where a variable is kept at run time
+	struct Location
+	{
+		enum class Kind { REGISTER, ENVIRONMENT, GLOBAL } kind_;
+		unsigned depth_;			// environments out from the current one
+		unsigned index_;			// register, slot or global slot
+	};
+
+	RegisterProgram * program_;
+	RegisterChunk * chunk_;				// chunk currently being written
+	std::vector<Scope> scopes_;
+	std::vector<bool> globalNumbers_;	// each global slot was declared as a number
+	unsigned function_;					// nesting depth of the function being compiled, 0 for the script
+	unsigned next_;						// first free register of the frame window
+	unsigned floor_;					// first temporary register of the statement being compiled
+	unsigned dst_;						// register the expression being visited leaves its value in
+	bool number_;						// the expression visited last was declared to give a number
+
+public:
+	RegisterCompiler();
+	std::unique_ptr<RegisterProgram> compile(std::list<Statement::pointer_type> const& statements, unsigned globalSlots);
+
+	virtual Value visit(AssignExpression * expr) override;
+	virtual Value visit(BinaryExpression * expr) override;
+	virtual Value visit(CallExpression * expr) override;
+	virtual Value visit(UnaryExpression * expr) override;
+	virtual Value visit(GroupExpression * expr) override;
+	virtual Value visit(LiteralExpression * expr) override;
+	virtual Value visit(LogicalExpression * expr) override;
+	virtual Value visit(VariableExpression * expr) override;
+	virtual Value visit(GetExpression * expr) override;
+	virtual Value visit(SetExpression * expr) override;
+	virtual Value visit(MeExpression * expr) override;
+	virtual Value visit(SuperExpression * expr) override;
+
+	virtual void visit(StmtExpression * expr) override;
+	virtual void visit(StmtFunc * expr) override;
+	virtual void visit(StmtPrint * expr) override;
+	virtual void visit(StmtReturn * expr) override;
+	virtual void visit(StmtVariable * expr) override;
+	virtual void visit(StmtBlock * expr) override;
+	virtual void visit(StmtClass * expr) override;
+	virtual void visit(StmtIf * expr) override;
+	virtual void visit(StmtWhile * expr) override;
+	virtual void visit(StmtDoWhile * expr) override;
+
+private:
+	void compile(Statement::pointer_type const& statement);
+	void compileStatements(std::list<Statement::pointer_type> const& statements);
+	bool compile(Expression::expr_type const& expr, unsigned dst);
+	bool direct(Expression::expr_type const& expr, unsigned & rk, bool & number);
+	unsigned operand(Expression::expr_type const& expr, bool & number);
+	unsigned temporary(Expression::expr_type const& expr, bool & number);
+	unsigned compileFunction(StmtFunc * func, bool method);
+
+	Location locate(unsigned depth, unsigned slot, bool global, bool & number) const;
+	Location declaration(unsigned slot) const;
+	void load(Location const& loc, unsigned dst);
+	bool store(Location const& loc, Expression::expr_type const& expr, bool check, VarType type, unsigned dst);
+	void declareNumber(unsigned slot, bool number);
+	std::size_t branch(Expression::expr_type const& cond, bool when, Condition kind);
+
+	unsigned allocate();
+	std::size_t emit(RegOp op, unsigned a = 0, unsigned b = 0, unsigned c = 0);
+	void patch(std::size_t at);
+	unsigned addConstant(Value const& val);
+	unsigned addName(std::string const& name);
+	unsigned addSite(std::string const& name);
+};
@@ -0,0 +1,661 @@
+/**	@file register_vm.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of RegisterVM class
+*/
+
+#include "register_vm.hpp"
+#include "bytecode.hpp"
+#include "fast_path.hpp"
+#include "interpreter.hpp"
+#include "beta_class.hpp"
+#include "beta_instance.hpp"
+#include "position_tracker.hpp"
+#include <iostream>
+#include <map>
+#include <sstream>
+using namespace std;
+
+/**
+@name:		conditionError
+@purpose:	returns the message the interpreter gives for a non-boolean condition in a statement
+@param:		Condition
+@return:	char const *
+*/
+static char const* conditionError(Condition cond)
+{
+	switch (cond)
+	{
+	case Condition::IF:		return "InterpreterException: If-Statement condition must evaluate to true or false.";
+	case Condition::WHILE:	return "While-loop condition must evaluate to true or false.";
+	default:				return "Do-While loop condition must evaluate to true or false.";
+	}
+}
+
+/**
+@name:		test
+@purpose:	returns a conditional jump's condition, throwing the error of the statement it tests if it is not a boolean
+@param:		Value const &, RegInstruction const *
+@return:	bool
+*/
+static inline bool test(Value const& val, RegInstruction const * in)
+{
+	if (!val.isBool())
+		throw Interpreter::InterpreterException(conditionError(in->cond_));
+	return val.asBool();
+}
+
+/**
+@name:		binary
+@purpose:	performs a binary operator on any two values
+@param:		Value const &, Value const &
+@return:	Value
+*/
+template <typename Op>
+static inline Value binary(Value const& first, Value const& second)
+{
+	static Op op;
+	return op.Op::perform(first, second);
+}
+
+/**
+@name:		numeric
+@purpose:	performs a binary operator on operands declared as numbers, on the int path, then the float path, and
+			by perform() when they fail both, as a number variable may still be null or hold a big integer
+@param:		Value const &, Value const &
+@return:	Value
+*/
+template <typename Op, BinaryPath IntPath, BinaryPath FloatPath>
+static inline Value numeric(Value const& first, Value const& second)
+{
+	Value result = runBinaryPath(IntPath, first, second);
+	if (!result.isNil())
+		return result;
+
+	result = runBinaryPath(FloatPath, first, second);
+	if (!result.isNil())
+		return result;
+
+	return binary<Op>(first, second);
+}
+
+/**
+@name:		unary
+@purpose:	performs a unary operator on any value
+@param:		Value const &
+@return:	Value
+*/
+template <typename Op>
+static inline Value unary(Value const& operand)
+{
+	static Op op;
+	return op.Op::perform(operand);
+}
+
+RegisterVM::RegisterVM(Environment::pointer_type globals) : program_(nullptr), globals_(std::move(globals)) {}
+
+/**
+@name:		run
+@purpose:	executes a compiled program, whose registers are the global environment
+@param:		RegisterProgram const &
+@return:	void
+*/
+void RegisterVM::run(RegisterProgram const& program)
+{
+	program_ = &program;
+	pool_.release(0);
+
+	// the script's blocks and temporaries come after the globals
+	if (globals_->slots_.size() < program.script_.registers_)
+		globals_->slots_.resize(program.script_.registers_);
+
+	frames_.clear();
+	frames_.push_back(CallFrame{ nullptr, &program.script_, program.script_.code_.data(), globals_, globals_, Value(), Value(), 0, 0 });
+	execute();
+
+	frames_.clear();
+	program_ = nullptr;
+}
+
+/**
+@name:		execute
+@purpose:	runs frames until the script halts; a call to a script function enters its frame here instead of
+			nesting another dispatch loop, so deep recursion does not grow the native stack
+@param:		null
+@return:	void
+*/
+void RegisterVM::execute()
+{
+	while (resume())
+		;
+}
+
+/**
+@name:		resume
+@purpose:	the dispatch loop, runs the frame on top from where it left off until it enters or leaves a call
+@param:		null
+@return:	bool - false once the script halts
+*/
+bool RegisterVM::resume()
+{
+	CallFrame * frame = &frames_.back();
+	Environment::pointer_type env = frame->env_;		// innermost environment, the window or a captured block's
+	Value * regs = frame->window_->slots_.data();
+	Value const * constants = frame->chunk_->constants_.data();
+	RegInstruction const * code = frame->chunk_->code_.data();
+	RegInstruction const * ip = frame->ip_;
+	RegInstruction const * in;
+
+	// a pooled window lives no longer than its call, so its variables may hold young values too
+	bool young = frame->window_->pooled_;
+
+	auto rk = [regs, constants](unsigned operand) -> Value const& {
+		return (operand & RK_CONSTANT) ? constants[operand & ~RK_CONSTANT] : regs[operand];
+	};
+	auto set = [regs, young, &in](unsigned reg, Value val) {
+		if (in->promote_ && !young)
+			val.promote();
+		regs[reg] = std::move(val);
+	};
+
+	for (;;)
+	{
+		in = ip++;
+		switch (in->op_)
+		{
+		case RegOp::MOVE:
+			set(in->a_, rk(in->c_));
+			break;
+		case RegOp::LOAD_NIL:
+			regs[in->a_] = Value();
+			break;
+		case RegOp::GET_ENV:
+			set(in->a_, env->getAt(in->b_, in->c_));
+			break;
+		case RegOp::SET_ENV:
+			env->reassignAt(in->b_, in->c_, regs[in->a_]);
+			break;
+		case RegOp::GET_GLOBAL:
+			set(in->a_, globals_->get(in->c_));
+			break;
+		case RegOp::SET_GLOBAL:
+			globals_->define(in->c_, regs[in->a_]);
+			break;
+		case RegOp::CHECK_TYPE:
+		{
+			VarType type = static_cast<VarType>(in->b_);
+			if (!Interpreter::checkType(type, regs[in->a_]))
+				throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + regs[in->a_].toString() + "\" to a " + Interpreter::VarTypeName(type)).c_str());
+			break;
+		}
+		case RegOp::BEGIN_SCOPE:
+			env = Heap::get().make<Environment>(env, in->c_);
+			break;
+		case RegOp::END_SCOPE:
+			env = env->parent_;
+			break;
+		case RegOp::GET_PROPERTY:
+		{
+			PropertySite & site = frame->chunk_->sites_[in->c_];
+			BetaInstance::pointer_type instance = instanceOf(rk(in->b_), site.name_);
+
+			PropertyCache::Entry const * entry = site.cache_.lookup(instance->getClass(), site.name_);
+			if (entry == nullptr)
+				set(in->a_, instance->get(site.name_));	// reports the undefined property
+			else if (entry->offset_ >= 0)
+				set(in->a_, instance->getField(entry->offset_));
+			else
+				set(in->a_, Value(entry->method_->bind(instance)));
+			break;
+		}
+		case RegOp::CHECK_INSTANCE:
+		{
+			Value const& obj = regs[in->a_];
+			if (!obj.isObject() || !is<BetaInstance>(obj.ref()))
+			{
+				stringstream ss;
+				ss << "InterpreterException: " << "\"" << obj.toString() << "\" is not an object.";
+				throw Interpreter::InterpreterException(ss.str().c_str());
+			}
+			break;
+		}
+		case RegOp::SET_PROPERTY:
+		{
+			PropertySite & site = frame->chunk_->sites_[in->c_];
+			BetaInstance::pointer_type instance = regs[in->a_].as<BetaInstance>();
+			Value const& val = rk(in->b_);
+
+			PropertyCache::Entry const * entry = site.cache_.lookup(instance->getClass(), site.name_);
+			if (entry == nullptr || entry->offset_ < 0)
+				instance->set(site.name_, val);		// reports the missing field
+			else
+				instance->setField(entry->offset_, val);
+			break;
+		}
+		case RegOp::GET_METHOD:
+		{
+			PropertySite & site = frame->chunk_->sites_[in->c_];
+			BetaInstance::pointer_type instance = instanceOf(rk(in->b_), site.name_);
+
+			PropertyCache::Entry const * entry = site.cache_.lookup(instance->getClass(), site.name_);
+			if (entry != nullptr && entry->offset_ < 0)
+			{
+				set(in->a_, Value(CustomFunction::pointer_type(entry->method_)));
+				set(in->a_ + 1, Value(instance));
+			}
+			else
+			{
+				// a field holding a function is called like any other value
+				set(in->a_, entry == nullptr ? instance->get(site.name_) : instance->getField(entry->offset_));
+				checkCallable(regs[in->a_]);
+				regs[in->a_ + 1] = Value();
+			}
+			break;
+		}
+		case RegOp::GET_SUPER:
+		{
+			string const& name = frame->chunk_->names_[in->b_];
+			BetaClass::pointer_type super = env->getAt(in->c_, 0).as<BetaClass>();
+			BetaInstance::pointer_type obj = regs[in->a_].as<BetaInstance>();
+			CustomFunction::pointer_type method = super->findMethod(obj, name);
+
+			if (method == nullptr)
+			{
+				stringstream ss;
+				ss << "InterpreterException: \"" << name << "\" is undefined.";
+				throw Interpreter::InterpreterException(ss.str().c_str());
+			}
+
+			set(in->a_, Value(method));
+			break;
+		}
+
+		case RegOp::POWER:			set(in->a_, binary<Power>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::ADD:			set(in->a_, binary<Addition>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::SUBTRACT:		set(in->a_, binary<Subtraction>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::MULTIPLY:		set(in->a_, binary<Multiplication>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::DIVIDE:			set(in->a_, binary<Division>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::MODULUS:		set(in->a_, binary<Modulus>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::AND:			set(in->a_, binary<And>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::NAND:			set(in->a_, binary<Nand>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::OR:				set(in->a_, binary<Or>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::NOR:			set(in->a_, binary<Nor>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::XOR:			set(in->a_, binary<Xor>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::XNOR:			set(in->a_, binary<Xnor>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::EQUAL:			set(in->a_, binary<Equality>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::NOT_EQUAL:		set(in->a_, binary<Inequality>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::GREATER:		set(in->a_, binary<Greater>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::GREATER_EQUAL:	set(in->a_, binary<GreaterEqual>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::LESS:			set(in->a_, binary<Less>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::LESS_EQUAL:		set(in->a_, binary<LessEqual>(rk(in->b_), rk(in->c_))); break;
+
+		case RegOp::ADD_NUM:			set(in->a_, numeric<Addition, BinaryPath::INT_ADD, BinaryPath::FLOAT_ADD>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::SUBTRACT_NUM:		set(in->a_, numeric<Subtraction, BinaryPath::INT_SUB, BinaryPath::FLOAT_SUB>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::MULTIPLY_NUM:		set(in->a_, numeric<Multiplication, BinaryPath::INT_MUL, BinaryPath::FLOAT_MUL>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::DIVIDE_NUM:			set(in->a_, numeric<Division, BinaryPath::INT_DIV, BinaryPath::FLOAT_DIV>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::MODULUS_NUM:		set(in->a_, numeric<Modulus, BinaryPath::INT_MOD, BinaryPath::GENERIC>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::EQUAL_NUM:			set(in->a_, numeric<Equality, BinaryPath::INT_EQUAL, BinaryPath::FLOAT_EQUAL>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::NOT_EQUAL_NUM:		set(in->a_, numeric<Inequality, BinaryPath::INT_NOT_EQUAL, BinaryPath::FLOAT_NOT_EQUAL>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::GREATER_NUM:		set(in->a_, numeric<Greater, BinaryPath::INT_GREATER, BinaryPath::FLOAT_GREATER>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::GREATER_EQUAL_NUM:	set(in->a_, numeric<GreaterEqual, BinaryPath::INT_GREATER_EQUAL, BinaryPath::FLOAT_GREATER_EQUAL>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::LESS_NUM:			set(in->a_, numeric<Less, BinaryPath::INT_LESS, BinaryPath::FLOAT_LESS>(rk(in->b_), rk(in->c_))); break;
+		case RegOp::LESS_EQUAL_NUM:		set(in->a_, numeric<LessEqual, BinaryPath::INT_LESS_EQUAL, BinaryPath::FLOAT_LESS_EQUAL>(rk(in->b_), rk(in->c_))); break;
+
+		case RegOp::FACTORIAL:		set(in->a_, unary<Factorial>(rk(in->b_))); break;
+		case RegOp::IDENTITY:		set(in->a_, unary<Identity>(rk(in->b_))); break;
+		case RegOp::NEGATE:			set(in->a_, unary<Negation>(rk(in->b_))); break;
+		case RegOp::NOT:			set(in->a_, unary<Not>(rk(in->b_))); break;
+		case RegOp::NEGATE_NUM:
+		{
+			Value result = runUnaryPath(UnaryPath::INT_NEGATE, rk(in->b_));
+			set(in->a_, result.isNil() ? unary<Negation>(rk(in->b_)) : std::move(result));
+			break;
+		}
+
+		case RegOp::JUMP:
+			ip = code + in->c_;
+			break;
+		case RegOp::JUMP_IF_FALSE:
+		case RegOp::JUMP_IF_TRUE:
+		{
+			if (test(regs[in->a_], in) == (in->op_ == RegOp::JUMP_IF_TRUE))
+				ip = code + in->c_;
+			break;
+		}
+
+		case RegOp::JUMP_IF_EQUAL_NUM:
+			if (test(numeric<Equality, BinaryPath::INT_EQUAL, BinaryPath::FLOAT_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_IF_NOT_EQUAL_NUM:
+			if (test(numeric<Inequality, BinaryPath::INT_NOT_EQUAL, BinaryPath::FLOAT_NOT_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_IF_GREATER_NUM:
+			if (test(numeric<Greater, BinaryPath::INT_GREATER, BinaryPath::FLOAT_GREATER>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_IF_GREATER_EQUAL_NUM:
+			if (test(numeric<GreaterEqual, BinaryPath::INT_GREATER_EQUAL, BinaryPath::FLOAT_GREATER_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_IF_LESS_NUM:
+			if (test(numeric<Less, BinaryPath::INT_LESS, BinaryPath::FLOAT_LESS>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_IF_LESS_EQUAL_NUM:
+			if (test(numeric<LessEqual, BinaryPath::INT_LESS_EQUAL, BinaryPath::FLOAT_LESS_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_UNLESS_EQUAL_NUM:
+			if (!test(numeric<Equality, BinaryPath::INT_EQUAL, BinaryPath::FLOAT_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_UNLESS_NOT_EQUAL_NUM:
+			if (!test(numeric<Inequality, BinaryPath::INT_NOT_EQUAL, BinaryPath::FLOAT_NOT_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_UNLESS_GREATER_NUM:
+			if (!test(numeric<Greater, BinaryPath::INT_GREATER, BinaryPath::FLOAT_GREATER>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_UNLESS_GREATER_EQUAL_NUM:
+			if (!test(numeric<GreaterEqual, BinaryPath::INT_GREATER_EQUAL, BinaryPath::FLOAT_GREATER_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_UNLESS_LESS_NUM:
+			if (!test(numeric<Less, BinaryPath::INT_LESS, BinaryPath::FLOAT_LESS>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+		case RegOp::JUMP_UNLESS_LESS_EQUAL_NUM:
+			if (!test(numeric<LessEqual, BinaryPath::INT_LESS_EQUAL, BinaryPath::FLOAT_LESS_EQUAL>(rk(in->a_), rk(in->b_)), in))
+				ip = code + in->c_;
+			break;
+
+		case RegOp::AND_THEN:
+		case RegOp::OR_ELSE:
+		{
+			// an And whose left side is false, or an Or whose left side is true, is already decided
+			if (!regs[in->a_].isBool())
+				throw Interpreter::InterpreterException("Condition must evaluate to true or false.");
+
+			if (regs[in->a_].asBool() == (in->op_ == RegOp::OR_ELSE))
+				ip = code + in->c_;
+			break;
+		}
+
+		case RegOp::CHECK_CALLABLE:
+			checkCallable(regs[in->a_]);
+			break;
+		case RegOp::CALL:
+		{
+			frame->ip_ = ip;
+			frame->env_ = env;
+
+			Value result;
+			if (call(regs[in->a_], ArgSpan(regs + in->a_ + 1, in->b_), in->a_, result))
+				return true;
+
+			set(in->a_, std::move(result));
+			break;
+		}
+		case RegOp::INVOKE:
+		{
+			frame->ip_ = ip;
+			frame->env_ = env;
+
+			ArgSpan args(regs + in->a_ + 2, in->b_);
+			Value result;
+
+			if (regs[in->a_ + 1].isNil())
+			{
+				if (!call(regs[in->a_], args, in->a_, result))
+				{
+					set(in->a_, std::move(result));
+					break;
+				}
+			}
+			else
+			{
+				CustomFunction::pointer_type method = regs[in->a_].as<CustomFunction>();
+				checkArity(*method, in->b_);
+				callFunction(method, regs[in->a_ + 1], Value(), args, in->a_);
+			}
+			return true;
+		}
+		case RegOp::CLOSURE:
+		{
+			RegisterProto const& proto = *program_->functions_[in->c_];
+			set(in->a_, Value(Heap::get().make<CustomFunction>(proto.declaration_, env, false, false, nullptr, nullptr, &proto)));
+			break;
+		}
+		case RegOp::INHERIT:
+		{
+			Value const& super = rk(in->a_);
+			if (!super.isObject() || !is<BetaClass>(super.ref()))
+			{
+				stringstream ss;
+				ss << "InterpreterException: \"" << super.toString() << "\" is not a known class.";
+				throw Interpreter::InterpreterException(ss.str().c_str());
+			}
+
+			// super is just inside of the class's environment
+			env = Heap::get().make<Environment>(env, 1);
+			env->define(0, super);
+			break;
+		}
+		case RegOp::CLASS:
+		{
+			RegisterClass const& proto = program_->classes_[in->c_];
+			StmtClass const& decl = *proto.declaration_;
+
+			map<string, CustomFunction::pointer_type> methods;
+			auto itProto = proto.methods_.cbegin();
+			for (auto const& method : decl.methods_)
+			{
+				RegisterProto const& func = *program_->functions_[*itProto++];
+				methods.insert(pair<string, CustomFunction::pointer_type>(method->ident_->getName(), Heap::get().make<CustomFunction>(method.get(), env, true, method->ident_->getName() == "init", nullptr, nullptr, &func)));
+			}
+
+			BetaClass::pointer_type super;
+			if (decl.super_ != nullptr)
+			{
+				super = env->get(0).as<BetaClass>();
+				env = env->parent_;
+			}
+
+			set(in->a_, Value(Heap::get().make<BetaClass>(decl.name_->getName(), super, decl.data_, methods)));
+			break;
+		}
+		case RegOp::RETURN:
+		case RegOp::LEAVE:
+		{
+			bool explicitReturn = in->op_ == RegOp::RETURN;
+			Value result = returnValue(explicitReturn ? rk(in->a_) : Value(), explicitReturn);
+			unsigned target = frame->result_;
+
+			pool_.release(frame->poolMark_);
+			frames_.pop_back();
+
+			// the caller's call instruction decides whether its register is a variable
+			CallFrame & caller = frames_.back();
+			if (caller.ip_[-1].promote_ && !caller.window_->pooled_)
+				result.promote();
+			caller.window_->slots_[target] = std::move(result);
+			return true;
+		}
+		case RegOp::PRINT:
+			cout << rk(in->a_).toString() << endl;
+			break;
+		case RegOp::NEXT_STATEMENT:
+			++PositionTracker::itStmtPos_;
+			break;
+		case RegOp::HALT:
+			return false;
+		}
+	}
+}
+
+/**
+@name:		call
+@purpose:	calls a function, class or native function with arguments that are already in registers; returns true
+			if it entered a script function's frame, whose return writes the result, or gives the result otherwise
+@param:		Value const &, ArgSpan, unsigned, Value &
+@return:	bool
+*/
+bool RegisterVM::call(Value const& callee, ArgSpan args, unsigned target, Value & result)
+{
+	checkCallable(callee);
+
+	BetaCallable::pointer_type func = callee.as<BetaCallable>();
+	checkArity(*func, args.size());
+
+	if (is<CustomFunction>(func))
+	{
+		CustomFunction::pointer_type custom = static_pointer_cast<CustomFunction>(func);
+		callFunction(custom, custom->receiver_, Value(), args, target);
+		return true;
+	}
+
+	if (is<BetaClass>(func))
+	{
+		BetaClass & cla = static_cast<BetaClass&>(*func);
+		BetaInstance::pointer_type instance = cla.instantiate();
+		CustomFunction::pointer_type init = cla.initializer();
+
+		// the call gives back the instance whatever init returns
+		if (init != nullptr)
+		{
+			callFunction(init, Value(instance), Value(instance), args, target);
+			return true;
+		}
+
+		result = Value(instance);
+		return false;
+	}
+
+	// native functions never look at the interpreter
+	result = func->call(nullptr, args);
+	return false;
+}
+
+/**
+@name:		callFunction
+@purpose:	copies the receiver and arguments into a new window and enters the function's frame
+@param:		CustomFunction::pointer_type const &, Value const &, Value const &, ArgSpan, unsigned
+@return:	void
+*/
+void RegisterVM::callFunction(CustomFunction::pointer_type const& func, Value const& receiver, Value const& instance, ArgSpan args, unsigned target)
+{
+	RegisterProto const& proto = *func->registerProto_;
+	StmtFunc const& declaration = *proto.declaration_;
+
+	// a call whose scope no closure captures borrows its window from the pool
+	size_t mark = pool_.mark();
+	Environment::pointer_type window = declaration.captured_
+		? Heap::get().make<Environment>(func->closure_, proto.chunk_.registers_)
+		: pool_.acquire(func->closure_, proto.chunk_.registers_);
+	unsigned slot = 0;
+
+	if (func->isMethod_)
+		window->define(slot++, receiver);
+
+	auto itParams = declaration.params_.cbegin();
+	for (size_t i = 0; i < args.size(); ++i, ++itParams)
+	{
+		VarType type = static_cast<Variable *>(itParams->get())->getType();
+		if (!declaration.argsChecked_ && !Interpreter::checkType(type, args[i]))
+			throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + args[i].toString() + "\" to a " + Interpreter::VarTypeName(type)).c_str());
+
+		window->define(slot++, args[i]);
+	}
+
+	frames_.push_back(CallFrame{ func, &proto.chunk_, proto.chunk_.code_.data(), window, window, receiver, instance, target, mark });
+}
+
+/**
+@name:		checkArity
+@purpose:	throws if a call passes the wrong number of arguments
+@param:		BetaCallable &, std::size_t
+@return:	void
+*/
+void RegisterVM::checkArity(BetaCallable & func, std::size_t count)
+{
+	if (count != func.arity())
+	{
+		stringstream ss;
+		ss << "Expected " << func.arity() << " arguments, but received " << count << ".";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+}
+
+/**
+@name:		returnValue
+@purpose:	returns what the call on top evaluates to, an init method always gives back its instance
+@param:		Value, bool
+@return:	Value
+*/
+Value RegisterVM::returnValue(Value val, bool explicitReturn)
+{
+	CallFrame const& frame = frames_.back();
+	CustomFunction const& func = *frame.function_;
+
+	if (func.isInit_ && val.isNil())
+		return frame.receiver_;
+
+	// only a return statement is checked against the function's type, and only if the type checker could not prove it
+	VarType type = func.declaration_->ident_->getType();
+	if (explicitReturn && !func.declaration_->returnsChecked_ && !Interpreter::checkType(type, val))
+		throw Interpreter::InterpreterException(string("InterpreterException: Cannot return \"" + val.toString() + "\" when expected type is " + Interpreter::VarTypeName(type)).c_str());
+
+	// a constructor's call gives back its instance, whatever init returns
+	if (!frame.instance_.isNil())
+		return frame.instance_;
+	return val;
+}
+
+/**
+@name:		checkCallable
+@purpose:	throws if a value cannot be called
+@param:		Value const &
+@return:	void
+*/
+void RegisterVM::checkCallable(Value const& callee)
+{
+	if (callee.isNil())
+	{
+		stringstream ss;
+		ss << "\"" << callee.toString() << "\" is not initialized!";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	if (!callee.isObject() || !is<BetaCallable>(callee.ref()))
+		throw Interpreter::InterpreterException("Can only call functions.");
+}
+
+/**
+@name:		instanceOf
+@purpose:	returns the instance whose property is being accessed, or throws if the value is not one
+@param:		Value const &, std::string const &
+@return:	BetaInstance::pointer_type
+*/
+BetaInstance::pointer_type RegisterVM::instanceOf(Value const& obj, std::string const& name)
+{
+	if (obj.isNil())
+	{
+		stringstream ss;
+		ss << "\"" << name << "\" is not initialized!";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	if (!obj.isObject() || !is<BetaInstance>(obj.ref()))
+	{
+		stringstream ss;
+		ss << "InterpreterException: " << "\"" << name << "\" is not an object.";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	return obj.as<BetaInstance>();
+}
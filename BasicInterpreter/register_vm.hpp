@@ -0,0 +1,52 @@
+/**	@file register_vm.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the register-based virtual machine that runs register code
+*/
+
+#pragma once
+#include "register_code.hpp"
+#include "environment.hpp"
+#include "custom_func.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class RegisterVM
+{
+private:
+	struct CallFrame
+	{
+		CustomFunction::pointer_type function_;		// null for the top-level script
+		RegisterChunk const * chunk_;
+		RegInstruction const * ip_;
+		Environment::pointer_type window_;			// the registers
+		Environment::pointer_type env_;				// innermost environment, the window or a captured block's
+		Value receiver_;							// instance passed as "me" to a method
+		Value instance_;							// instance a constructor's call gives back, null for any other call
+		unsigned result_;							// caller's register that receives the call's value
+		std::size_t poolMark_;						// pooled windows above this belong to the call
+	};
+
+	FramePool pool_;			// windows of the calls that nothing captures, outlives the frames below
+	RegisterProgram const * program_;
+	Environment::pointer_type globals_;
+	std::vector<CallFrame> frames_;
+
+public:
+	RegisterVM(Environment::pointer_type globals);
+	void run(RegisterProgram const& program);
+
+private:
+	void execute();
+	bool resume();
+	bool call(Value const& callee, ArgSpan args, unsigned target, Value & result);
+	void callFunction(CustomFunction::pointer_type const& func, Value const& receiver, Value const& instance, ArgSpan args, unsigned target);
+	void checkArity(BetaCallable & func, std::size_t count);
+	Value returnValue(Value val, bool explicitReturn);
+
+	void checkCallable(Value const& callee);
+	Ref<BetaInstance> instanceOf(Value const& obj, std::string const& name);
+};
@@ -19,7 +19,7 @@ using namespace std;
 */
 void Resolver::visit(StmtVariable * expr)
 {
-	declare(expr->var_);
+	expr->slot_ = declare(expr->var_, expr->var_->getType());
 	if (expr->expr_ != nullptr)
 		resolve(expr->expr_);
 	define(expr->var_);
@@ -33,8 +33,16 @@ void Resolver::visit(StmtVariable * expr)
 */
 void Resolver::visit(StmtBlock * expr)
 {
+	// a block only needs its own scope if it declares something
+	expr->numSlots_ = countDeclarations(expr->statements_);
+	if (expr->numSlots_ == 0)
+	{
+		resolve(expr->statements_);
+		return;
+	}
+
 	// create new scope that encompasses block
-	beginScope();
+	beginScope(&expr->captured_);
 	resolve(expr->statements_);
 	endScope();
 }
@@ -49,7 +57,8 @@ void Resolver::visit(StmtClass * expr)
 {
 	curClass_ = ClassType::CLASS;
 
-	declare(expr->name_);
+	expr->slot_ = declare(expr->name_, VarType::OBJECT);
+	captureScopes();		// methods close over the scope the class is declared in
 	
 	if (expr->super_ != nullptr)
 	{
@@ -63,29 +72,22 @@ void Resolver::visit(StmtClass * expr)
 	if (expr->super_ != nullptr)
 	{
 		beginScope();
-		scopes_.back().insert(pair<string, bool>("super", true));
+		scopes_.back().insert(pair<string, Binding>("super", Binding{ true, 0, VarType::OBJECT }));
 	}
 
-	// method and variable scope
+	// data lives in each instance rather than in a scope, so it is only checked for duplicates
 	beginScope();
-	for (auto datum : expr->data_)
-	{
-		declare(datum);
-		define(datum);
-	}
+	for (auto const& datum : expr->data_)
+		declare(datum, datum->getType());
+	endScope();
 
-	scopes_.back().insert(pair<string, bool>("me", true));
-	
-	for (auto method : expr->methods_)
+	for (auto const& method : expr->methods_)
 	{
 		if (method->ident_->getName() == "init")
 			resolveFunction(&*method, FuncType::INIT);
 		else
 			resolveFunction(&*method, FuncType::METHOD);
 	}
-		
-
-	endScope();
 
 	if (expr->super_ != nullptr)
 		endScope();
@@ -133,12 +135,12 @@ void Resolver::visit(StmtDoWhile * expr)
 /**
 @name:		resolve
 @purpose:	resolves a list of statements
-@param:		std::list<Statement::pointer_type>
+@param:		std::list<Statement::pointer_type> const &
 @return:	void
 */
-void Resolver::resolve(std::list<Statement::pointer_type> statements)
+void Resolver::resolve(std::list<Statement::pointer_type> const& statements)
 {
-	for (auto statement : statements)
+	for (auto const& statement : statements)
 	{
 		resolve(statement);
 		++PositionTracker::itStmtPos_;
@@ -155,30 +157,31 @@ Resolver::Resolver(Interpreter * interpreter)
 	// superglobal scope
 	beginScope();
 	
-	for (auto global : interpreter->globals_->variables_)
-		scopes_.back().insert(pair<string, bool>(global.first, global.second));
+	for (auto const& native : interpreter->nativeNames_)
+		scopes_.back().insert(pair<string, Binding>(native, Binding{ true, static_cast<unsigned>(scopes_.back().size()), VarType::OBJECT }));
 }
 
 /**
 @name:		resolve
 @purpose:	resolves a single statement
-@param:		Statement::pointer_type
+@param:		Statement::pointer_type const &
 @return:	void
 */
-void Resolver::resolve(Statement::pointer_type statement)
+void Resolver::resolve(Statement::pointer_type const& statement)
 {
 	statement->accept(*this);
 }
 
 /**
 @name:		beginScope
-@purpose:	begins a new scope
-@param:		null
+@purpose:	begins a new scope, owned by the node whose captured flag is given
+@param:		bool *
 @return:	void
 */
-void Resolver::beginScope()
+void Resolver::beginScope(bool * captured)
 {
-	scopes_.push_back(map<string, bool>());
+	scopes_.push_back(Scope());
+	captured_.push_back(captured);
 }
 
 /**
@@ -190,29 +193,41 @@ void Resolver::beginScope()
 void Resolver::endScope()
 {
 	scopes_.pop_back();
+	captured_.pop_back();
+}
+
+/**
+@name:		captureScopes
+@purpose:	marks every enclosing scope as captured, as a closure created here keeps all of them alive
+@param:		null
+@return:	void
+*/
+void Resolver::captureScopes()
+{
+	for (bool * captured : captured_)
+		if (captured != nullptr)
+			*captured = true;
 }
 
 /**
 @name:		resolve
 @purpose:	resolves an expression
-@param:		std::shared_ptr<Expression>
+@param:		Expression::expr_type const &
 @return:	void
 */
-void Resolver::resolve(std::shared_ptr<Expression> expr)
+void Resolver::resolve(Expression::expr_type const& expr)
 {
 	expr->accept(*this);
 }
 
 /**
 @name:		declare
-@purpose:	adds a variable to scope that has not yet been defined
-@param:		std::string
-@return:	void
+@purpose:	adds a variable to scope that has not yet been defined, and returns the slot it was given
+@param:		Token::pointer_type, VarType
+@return:	unsigned
 */
-void Resolver::declare(Token::pointer_type token)
+unsigned Resolver::declare(Token::pointer_type token, VarType type)
 {
-	if (scopes_.empty()) return;
-
 	if (scopes_.back().count(token->toString()) == 1)
 	{
 		// PositionTracker::lastTok_ = token;
@@ -221,7 +236,9 @@ void Resolver::declare(Token::pointer_type token)
 		throw ResolverException(ss.str());
 	}
 		
-	scopes_.back().insert(pair<string, bool>(token->toString(), false));
+	unsigned slot = static_cast<unsigned>(scopes_.back().size());
+	scopes_.back().insert(pair<string, Binding>(token->toString(), Binding{ false, slot, type }));
+	return slot;
 }
 
 /**
@@ -232,26 +249,26 @@ void Resolver::declare(Token::pointer_type token)
 */
 void Resolver::define(Token::pointer_type token)
 {
-	if (scopes_.empty()) return;
-
-	scopes_.back().at(token->toString()) = true;
+	scopes_.back().at(token->toString()).defined = true;
 }
 
 /**
 @name:		resolveLocal
-@purpose:	inserts a reference to a declared variable into the interpreter's memory, as well as the relative scope in which 
-			the declaration was made.
-@param:		Expression *, std::string
-@return:	void
+@purpose:	finds the declaration a variable refers to, as well as the relative scope in which 
+			the declaration was made, and whether that is the global scope.
+@param:		Token::pointer_type, unsigned &, bool &
+@return:	Binding const &
 */
-void Resolver::resolveLocal(Expression * expr, Token::pointer_type token)
+Resolver::Binding const& Resolver::resolveLocal(Token::pointer_type token, unsigned & depth, bool & global)
 {
 	for (int i = scopes_.size() - 1; i >= 0; --i)
 	{
-		if (scopes_.at(i).count(token->toString()) == 1)
+		auto itBinding = scopes_.at(i).find(token->toString());
+		if (itBinding != scopes_.at(i).end())
 		{
-			interpreter_->resolve(expr, scopes_.size() - 1 - i);
-			return;
+			depth = scopes_.size() - 1 - i;
+			global = i == 0;
+			return itBinding->second;
 		}
 	}
 
@@ -274,13 +291,19 @@ void Resolver::resolveFunction(StmtFunc * func, FuncType type)
 	FuncType parType = curFunc_;
 	curFunc_ = type;
 
-	beginScope();
-	for (auto param : func->params_)
+	beginScope(&func->captured_);
+
+	// a method receives its instance as "me" in the first slot, ahead of its parameters
+	if (type == FuncType::METHOD || type == FuncType::INIT)
+		scopes_.back().insert(pair<string, Binding>("me", Binding{ true, 0, VarType::OBJECT }));
+
+	for (auto const& param : func->params_)
 	{
-		declare(param);
+		declare(param, convert<Variable>(param)->getType());
 		define(param);
 	}
 	resolve(func->body_);
+	func->numSlots_ = static_cast<unsigned>(scopes_.back().size());
 	endScope();
 
 	curFunc_ = parType;
@@ -290,100 +313,105 @@ void Resolver::resolveFunction(StmtFunc * func, FuncType type)
 @name:		visit
 @purpose:	resolves the expression in a variable assignment
 @param:		AssignExpression *
-@return:	Token::pointer_type 
+@return:	Value 
 */
-Token::pointer_type Resolver::visit(AssignExpression * expr)
+Value Resolver::visit(AssignExpression * expr)
 {
 	resolve(expr->expr_);
-	resolveLocal(expr, expr->oper_);
-	return nullptr;
+
+	// the assigned value is checked against the type the variable was declared with
+	Binding const& binding = resolveLocal(expr->oper_, expr->depth_, expr->global_);
+	expr->slot_ = binding.slot;
+	expr->oper_->setType(binding.type);
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves both expressions in binary expression
 @param:		BinaryExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(BinaryExpression * expr)
+Value Resolver::visit(BinaryExpression * expr)
 {
 	resolve(expr->left_);
 	resolve(expr->right_);
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves the arguments and method of a call expression
 @param:		CallExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(CallExpression * expr)
+Value Resolver::visit(CallExpression * expr)
 {
 	resolve(expr->callee_);
 	for(auto arg : expr->args_)
 		resolve(arg);
 
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves the expression of a unary expression
 @param:		UnaryExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(UnaryExpression * expr)
+Value Resolver::visit(UnaryExpression * expr)
 {
 	resolve(expr->exp_);
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves the expression of a group expression
 @param:		GroupExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(GroupExpression * expr)
+Value Resolver::visit(GroupExpression * expr)
 {
 	resolve(expr->expr_);
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves the expression of a literal expression
 @param:		LiteralExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(LiteralExpression * expr)
+Value Resolver::visit(LiteralExpression * expr)
 {
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves the left and right expressions of a logical expression
 @param:		LogicalExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(LogicalExpression * expr)
+Value Resolver::visit(LogicalExpression * expr)
 {
 	resolve(expr->left_);
 	resolve(expr->right_);
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	ensures that the variable has been declared, and inserts a reference to it's expression into the interpreter 
 @param:		VariableExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(VariableExpression * expr)
+Value Resolver::visit(VariableExpression * expr)
 {
-	if (!scopes_.empty() && !(scopes_.back().at(expr->oper_->getName())))
+	auto itBinding = scopes_.back().find(expr->oper_->getName());
+	if (itBinding != scopes_.back().end() && !itBinding->second.defined)
 	{
 		/*PositionTracker::lastExp_ = Expression::pointer_type(expr);
 		PositionTracker::lastTok_ = expr->oper_;*/
@@ -392,42 +420,42 @@ Token::pointer_type Resolver::visit(VariableExpression * expr)
 		throw ResolverException(ss.str());
 	}
 
-	resolveLocal(expr, expr->oper_);
-	return nullptr;
+	expr->slot_ = resolveLocal(expr->oper_, expr->depth_, expr->global_).slot;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves the object of a get expression
 @param:		GetExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(GetExpression * expr)
+Value Resolver::visit(GetExpression * expr)
 {
 	resolve(expr->obj_);
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	resolves the object and value of a set expression
 @param:		SetExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(SetExpression * expr)
+Value Resolver::visit(SetExpression * expr)
 {
 	resolve(expr->val_);
 	resolve(expr->obj_);
-	return nullptr;
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	inserts a reference to the "me" keyword into the interpreter
 @param:		MeExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(MeExpression * expr)
+Value Resolver::visit(MeExpression * expr)
 {
 	if (curClass_ != ClassType::CLASS)
 	{
@@ -436,17 +464,18 @@ Token::pointer_type Resolver::visit(MeExpression * expr)
 		throw exception("ResolverException: Cannot use 'me' keyword outside of a class.");
 	}
 		
-	resolveLocal(expr, expr->keyword_);
-	return nullptr;
+	bool global;
+	resolveLocal(expr->keyword_, expr->depth_, global);
+	return Value();
 }
 
 /**
 @name:		visit
 @purpose:	inserts a reference to the "super" keyword into the interpreter
 @param:		SuperExpression *
-@return:	Token::pointer_type
+@return:	Value
 */
-Token::pointer_type Resolver::visit(SuperExpression * expr)
+Value Resolver::visit(SuperExpression * expr)
 {
 	if (curClass_ == ClassType::NONE)
 	{
@@ -461,8 +490,9 @@ Token::pointer_type Resolver::visit(SuperExpression * expr)
 		throw exception("Cannot use 'super' keyword in class with no superclass.");
 	}
 
-	resolveLocal(expr, expr->keyword_);
-	return nullptr;
+	bool global;
+	resolveLocal(expr->keyword_, expr->depth_, global);
+	return Value();
 }
 
 /**
@@ -484,8 +514,9 @@ void Resolver::visit(StmtExpression * expr)
 */
 void Resolver::visit(StmtFunc * expr)
 {
-	declare(expr->ident_);
+	expr->slot_ = declare(expr->ident_, VarType::OBJECT);
 	define(expr->ident_);
+	captureScopes();
 	resolveFunction(expr, FuncType::FUNC);
 }
 
@@ -528,3 +559,19 @@ void Resolver::visit(StmtReturn * expr)
 	}
 		
 }
+
+/**
+@name:		countDeclarations
+@purpose:	counts the variables, functions, and classes declared directly in a list of statements
+@param:		std::list<Statement::pointer_type> const &
+@return:	unsigned
+*/
+unsigned Resolver::countDeclarations(std::list<Statement::pointer_type> const& statements)
+{
+	unsigned count = 0;
+	for (auto const& statement : statements)
+		if (is<StmtVariable>(statement) || is<StmtFunc>(statement) || is<StmtClass>(statement))
+			++count;
+
+	return count;
+}
\ No newline at end of file
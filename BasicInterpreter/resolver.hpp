@@ -24,39 +24,52 @@ public:
 private:
 	enum class FuncType { NONE, FUNC, INIT, METHOD };
 	enum class ClassType { NONE, CLASS, SUBCLASS };
+
+	// a declared name, the slot it occupies in its scope's environment, and its declared type
+	struct Binding
+	{
+		bool defined;
+		unsigned slot;
+		VarType type;
+	};
+	using Scope = std::map<std::string, Binding>;
+
 	FuncType curFunc_;
 	ClassType curClass_;
-	std::vector<std::map<std::string, bool>> scopes_;
+	std::vector<Scope> scopes_;
+	std::vector<bool *> captured_;		// flag on the node that owns each scope, null for scopes that are always on the heap
 	Interpreter * interpreter_;
 
 public:
 	Resolver(Interpreter * interpreter);
 
 private:
-	void resolve(Statement::pointer_type statement);
-	void beginScope();
+	void resolve(Statement::pointer_type const& statement);
+	void beginScope(bool * captured = nullptr);
 	void endScope();
-	void resolve(std::shared_ptr<Expression> expr);
-	void declare(Token::pointer_type token);
+	void captureScopes();
+	void resolve(Expression::expr_type const& expr);
+	unsigned declare(Token::pointer_type token, VarType type);
 	void define(Token::pointer_type token);
-	void resolveLocal(Expression * expr, Token::pointer_type token);
+	Binding const& resolveLocal(Token::pointer_type token, unsigned & depth, bool & global);
+	static unsigned countDeclarations(std::list<Statement::pointer_type> const& statements);
 	void resolveFunction(StmtFunc * func, FuncType type);
 
 public:
-	void resolve(std::list<Statement::pointer_type> statements);
+	void resolve(std::list<Statement::pointer_type> const& statements);
 
-	virtual Token::pointer_type visit(AssignExpression * expr) override;
-	virtual Token::pointer_type visit(BinaryExpression * expr) override;
-	virtual Token::pointer_type visit(CallExpression * expr) override;
-	virtual Token::pointer_type visit(UnaryExpression * expr) override;
-	virtual Token::pointer_type visit(GroupExpression * expr) override;
-	virtual Token::pointer_type visit(LiteralExpression * expr) override;
-	virtual Token::pointer_type visit(LogicalExpression * expr) override;
-	virtual Token::pointer_type visit(VariableExpression * expr) override;
-	virtual Token::pointer_type visit(GetExpression * expr) override;
-	virtual Token::pointer_type visit(SetExpression * expr) override;
-	virtual Token::pointer_type visit(MeExpression * expr) override;
-	virtual Token::pointer_type visit(SuperExpression * expr) override;
+	virtual Value visit(AssignExpression * expr) override;
+	virtual Value visit(BinaryExpression * expr) override;
+	virtual Value visit(CallExpression * expr) override;
+	virtual Value visit(UnaryExpression * expr) override;
+	virtual Value visit(GroupExpression * expr) override;
+	virtual Value visit(LiteralExpression * expr) override;
+	virtual Value visit(LogicalExpression * expr) override;
+	virtual Value visit(VariableExpression * expr) override;
+	virtual Value visit(GetExpression * expr) override;
+	virtual Value visit(SetExpression * expr) override;
+	virtual Value visit(MeExpression * expr) override;
+	virtual Value visit(SuperExpression * expr) override;
 
 	virtual void visit(StmtExpression * expr) override;
 	virtual void visit(StmtFunc * expr) override;
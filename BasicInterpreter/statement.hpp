@@ -11,6 +11,7 @@
 #include "variable.hpp"
 #include "keywords.hpp"
 #include <list>
+#include <vector>
 
 class StmtVisitor;
 
@@ -31,8 +32,10 @@ public:
 	DEF_IS_CONVERTIBLE_FROM(StmtBlock)
 public:
 	std::list<Statement::pointer_type> statements_;
+	unsigned numSlots_;	// declarations made directly in the block, a block without any shares its parent's scope
+	bool captured_;		// a closure may outlive the block's environment, set by the resolver
 public:
-	StmtBlock(std::list<Statement::pointer_type> stats) : statements_(stats) {}
+	StmtBlock(std::list<Statement::pointer_type> stats) : statements_(stats), numSlots_(0), captured_(false) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -45,7 +48,7 @@ public:
 public:
 	Expression::expr_type expr_;
 public:
-	StmtExpression(Expression::expr_type expr) : expr_(expr) {}
+	StmtExpression(Expression::expr_type expr) : expr_(expr) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -58,11 +61,16 @@ public:
 public:
 	Variable::pointer_type ident_;
 	VarType retType_;
-	std::list<Token::pointer_type> params_;
+	std::vector<Token::pointer_type> params_;
 	std::list<Statement::pointer_type> body_;
+	unsigned slot_;		// slot of the function's name, set by the resolver
+	unsigned numSlots_;	// parameters followed by the body's declarations, set by the resolver
+	bool captured_;		// a closure may outlive the call's environment, set by the resolver
+	bool argsChecked_;	// every call passes arguments that suit the parameters, set by the type checker
+	bool returnsChecked_;	// every return gives a value that suits the function's type, set by the type checker
 public:
-	StmtFunc(Variable::pointer_type ident, std::list<Token::pointer_type> params, std::list<Statement::pointer_type> body) 
-				: ident_(ident), params_(params), body_(body) {}
+	StmtFunc(Variable::pointer_type ident, std::vector<Token::pointer_type> params, std::list<Statement::pointer_type> body) 
+				: ident_(ident), params_(params), body_(body), slot_(0), numSlots_(0), captured_(false), argsChecked_(false), returnsChecked_(false) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -77,8 +85,9 @@ public:
 	VariableExpression::pointer_type super_;
 	std::list<Variable::pointer_type> data_;
 	std::list<StmtFunc::pointer_type> methods_;
+	unsigned slot_;		// slot of the class's name, set by the resolver
 public:
-	StmtClass(Variable::pointer_type name, VariableExpression::pointer_type super, std::list<Variable::pointer_type> data, std::list<StmtFunc::pointer_type> methods) : name_(name), super_(super), data_(data), methods_(methods) {}
+	StmtClass(Variable::pointer_type name, VariableExpression::pointer_type super, std::list<Variable::pointer_type> data, std::list<StmtFunc::pointer_type> methods) : name_(name), super_(super), data_(data), methods_(methods), slot_(0) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -87,13 +96,13 @@ class StmtIf : public Statement
 {
 public:
 	DEF_POINTER_TYPE(StmtExpression)
-		DEF_IS_CONVERTIBLE_FROM(StmtExpression)
+		DEF_IS_CONVERTIBLE_FROM(StmtIf)
 public:
 	Expression::expr_type expr_;
 	stmt_p thenBlock_;
 	stmt_p elseBlock_;
 public:
-	StmtIf(Expression::expr_type expr, stmt_p thenBlock, stmt_p elseBlock) : expr_(expr), thenBlock_(thenBlock), elseBlock_(elseBlock) {}
+	StmtIf(Expression::expr_type expr, stmt_p thenBlock, stmt_p elseBlock) : expr_(expr), thenBlock_(thenBlock), elseBlock_(elseBlock) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -107,7 +116,7 @@ public:
 	Expression::expr_type expr_;
 	stmt_p whileBlock_;
 public:
-	StmtWhile(Expression::expr_type expr, stmt_p whileBlock) : expr_(expr), whileBlock_(whileBlock) {}
+	StmtWhile(Expression::expr_type expr, stmt_p whileBlock) : expr_(expr), whileBlock_(whileBlock) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -121,7 +130,7 @@ public:
 	Expression::expr_type expr_;
 	stmt_p whileBlock_;
 public:
-	StmtDoWhile(Expression::expr_type expr, stmt_p whileBlock) : expr_(expr), whileBlock_(whileBlock) {}
+	StmtDoWhile(Expression::expr_type expr, stmt_p whileBlock) : expr_(expr), whileBlock_(whileBlock) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -134,7 +143,7 @@ public:
 public:
 	Expression::expr_type expr_;
 public:
-	StmtPrint(Expression::expr_type expr) : expr_(expr) {}
+	StmtPrint(Expression::expr_type expr) : expr_(expr) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -148,7 +157,7 @@ public:
 	Return::pointer_type ret_;
 	Expression::expr_type expr_;
 public:
-	StmtReturn(Return::pointer_type ret, Expression::expr_type expr) : ret_(ret), expr_(expr) {}
+	StmtReturn(Return::pointer_type ret, Expression::expr_type expr) : ret_(ret), expr_(expr) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
@@ -157,12 +166,14 @@ class StmtVariable : public Statement
 {
 public:
 	DEF_POINTER_TYPE(StmtPrint)
-		DEF_IS_CONVERTIBLE_FROM(StmtPrint)
+		DEF_IS_CONVERTIBLE_FROM(StmtVariable)
 public:
 	Variable::pointer_type var_;
 	Expression::expr_type expr_;
+	unsigned slot_;		// slot of the variable, set by the resolver
+	bool checked_;		// the initializer always suits the variable's type, set by the type checker
 
-	StmtVariable(Variable::pointer_type var, Expression::expr_type expr) : var_(var), expr_(expr) {}
+	StmtVariable(Variable::pointer_type var, Expression::expr_type expr) : var_(var), expr_(expr), slot_(0), checked_(false) { kind_ = first_kind; }
 
 	virtual void accept(StmtVisitor &v);
 };
\ No newline at end of file
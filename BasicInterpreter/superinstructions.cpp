@@ -0,0 +1,320 @@
+/**	@file superinstructions.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of the superinstruction pass
+*/
+
+#include "superinstructions.hpp"
+#include <cstddef>
+#include <vector>
+using namespace std;
+
+namespace
+{
+	// an instruction decoded from a chunk, a jump's offset is its last operand
+	struct Instruction
+	{
+		OpCode op_;
+		unsigned operands_[6];
+		unsigned count_;
+		size_t target_;		// index of the instruction a jump goes to
+	};
+
+	enum class Jump { NONE, FORWARD, BACKWARD };
+}
+
+/**
+@name:		operandCount
+@purpose:	returns how many 16-bit operands follow an opcode
+@param:		OpCode
+@return:	unsigned
+*/
+static unsigned operandCount(OpCode op)
+{
+	switch (op)
+	{
+	case OpCode::CONSTANT:
+	case OpCode::GET_GLOBAL:
+	case OpCode::SET_GLOBAL:
+	case OpCode::DEFINE:
+	case OpCode::CHECK_TYPE:
+	case OpCode::BEGIN_SCOPE:
+	case OpCode::BEGIN_FRAME:
+	case OpCode::JUMP:
+	case OpCode::LOOP:
+	case OpCode::AND_THEN:
+	case OpCode::OR_ELSE:
+	case OpCode::CALL:
+	case OpCode::INVOKE:
+	case OpCode::CLOSURE:
+	case OpCode::CLASS:
+		return 1;
+	case OpCode::GET_LOCAL:
+	case OpCode::SET_LOCAL:
+	case OpCode::GET_PROPERTY:
+	case OpCode::SET_PROPERTY:
+	case OpCode::GET_SUPER:
+	case OpCode::GET_METHOD:
+	case OpCode::JUMP_IF_FALSE:
+	case OpCode::LOOP_IF_TRUE:
+	case OpCode::ADD_GLOBAL_CONST:
+		return 2;
+	case OpCode::ADD_LOCAL_CONST:
+	case OpCode::ADD_GLOBAL_CONST_CHECKED:
+		return 3;
+	case OpCode::ADD_LOCAL_CONST_CHECKED:
+		return 4;
+	case OpCode::JUMP_UNLESS_GLOBAL_CONST:
+		return 5;
+	case OpCode::JUMP_UNLESS_LOCAL_CONST:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+/**
+@name:		jumpOf
+@purpose:	returns which way an instruction jumps, if it does
+@param:		OpCode
+@return:	Jump
+*/
+static Jump jumpOf(OpCode op)
+{
+	switch (op)
+	{
+	case OpCode::JUMP:
+	case OpCode::JUMP_IF_FALSE:
+	case OpCode::AND_THEN:
+	case OpCode::OR_ELSE:
+	case OpCode::JUMP_UNLESS_LOCAL_CONST:
+	case OpCode::JUMP_UNLESS_GLOBAL_CONST:
+		return Jump::FORWARD;
+	case OpCode::LOOP:
+	case OpCode::LOOP_IF_TRUE:
+		return Jump::BACKWARD;
+	default:
+		return Jump::NONE;
+	}
+}
+
+/**
+@name:		isComparison
+@purpose:	returns true if an opcode compares two values
+@param:		OpCode
+@return:	bool
+*/
+static bool isComparison(OpCode op)
+{
+	return op >= OpCode::EQUAL && op <= OpCode::LESS_EQUAL;
+}
+
+/**
+@name:		decode
+@purpose:	splits a chunk's code into instructions and resolves each jump to the instruction it goes to
+@param:		std::vector<std::uint8_t> const &
+@return:	std::vector<Instruction>
+*/
+static vector<Instruction> decode(vector<uint8_t> const& code)
+{
+	vector<Instruction> instructions;
+	vector<size_t> starts;			// byte position of each instruction
+	vector<size_t> ends;
+
+	for (size_t at = 0; at < code.size();)
+	{
+		Instruction instruction{ static_cast<OpCode>(code[at]), {}, 0, 0 };
+		starts.push_back(at++);
+
+		instruction.count_ = operandCount(instruction.op_);
+		for (unsigned i = 0; i < instruction.count_; ++i, at += 2)
+			instruction.operands_[i] = code[at] | (code[at + 1] << 8);
+
+		ends.push_back(at);
+		instructions.push_back(instruction);
+	}
+
+	// a jump may also go to the end of the code
+	starts.push_back(code.size());
+
+	for (size_t i = 0; i < instructions.size(); ++i)
+	{
+		Instruction & instruction = instructions[i];
+		Jump jump = jumpOf(instruction.op_);
+		if (jump == Jump::NONE)
+			continue;
+
+		unsigned offset = instruction.operands_[instruction.count_ - 1];
+		size_t to = jump == Jump::FORWARD ? ends[i] + offset : ends[i] - offset;
+
+		size_t lo = 0, hi = starts.size() - 1;
+		while (lo < hi)
+		{
+			size_t mid = (lo + hi) / 2;
+			if (starts[mid] < to)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		instruction.target_ = lo;
+	}
+
+	return instructions;
+}
+
+/**
+@name:		fuse
+@purpose:	returns the superinstruction for the sequence that starts at an instruction, and how many instructions it
+			replaces, or 0 if no sequence starts there
+@param:		std::vector<Instruction> const &, std::size_t, Instruction &
+@return:	std::size_t
+*/
+static size_t fuse(vector<Instruction> const& code, size_t i, Instruction & fused)
+{
+	size_t left = code.size() - i;
+	if (left < 4 || code[i + 1].op_ != OpCode::CONSTANT)
+		return 0;
+
+	Instruction const& load = code[i];
+	unsigned constant = code[i + 1].operands_[0];
+	OpCode third = code[i + 2].op_;
+	Instruction const& fourth = code[i + 3];
+
+	bool local = load.op_ == OpCode::GET_LOCAL;
+	if (!local && load.op_ != OpCode::GET_GLOBAL)
+		return 0;
+
+	// the jump's Condition is kept, since a comparison with null gives null rather than a boolean
+	if (isComparison(third) && fourth.op_ == OpCode::JUMP_IF_FALSE)
+	{
+		unsigned cond = fourth.operands_[0];
+		if (local)
+			fused = Instruction{ OpCode::JUMP_UNLESS_LOCAL_CONST, { static_cast<unsigned>(third), cond, load.operands_[0], load.operands_[1], constant, 0 }, 6, fourth.target_ };
+		else
+			fused = Instruction{ OpCode::JUMP_UNLESS_GLOBAL_CONST, { static_cast<unsigned>(third), cond, load.operands_[0], constant, 0 }, 5, fourth.target_ };
+		return 4;
+	}
+
+	// an increment as a statement; one that is not proven to suit the variable's type checks the sum before storing it
+	if (third != OpCode::ADD)
+		return 0;
+
+	bool checked = fourth.op_ == OpCode::CHECK_TYPE;
+	size_t length = checked ? 6 : 5;
+	if (left < length || code[i + length - 1].op_ != OpCode::POP)
+		return 0;
+
+	unsigned type = fourth.operands_[0];
+	Instruction const& store = code[i + length - 2];
+
+	if (local && store.op_ == OpCode::SET_LOCAL && store.operands_[0] == load.operands_[0] && store.operands_[1] == load.operands_[1])
+	{
+		if (checked)
+			fused = Instruction{ OpCode::ADD_LOCAL_CONST_CHECKED, { load.operands_[0], load.operands_[1], constant, type }, 4, 0 };
+		else
+			fused = Instruction{ OpCode::ADD_LOCAL_CONST, { load.operands_[0], load.operands_[1], constant }, 3, 0 };
+		return length;
+	}
+
+	if (!local && store.op_ == OpCode::SET_GLOBAL && store.operands_[0] == load.operands_[0])
+	{
+		if (checked)
+			fused = Instruction{ OpCode::ADD_GLOBAL_CONST_CHECKED, { load.operands_[0], constant, type }, 3, 0 };
+		else
+			fused = Instruction{ OpCode::ADD_GLOBAL_CONST, { load.operands_[0], constant }, 2, 0 };
+		return length;
+	}
+
+	return 0;
+}
+
+/**
+@name:		fuseSuperinstructions
+@purpose:	replaces the sequences of a chunk that have a superinstruction, and moves its jumps to match
+@param:		Chunk &
+@return:	void
+*/
+void fuseSuperinstructions(Chunk & chunk)
+{
+	vector<Instruction> code = decode(chunk.code_);
+
+	vector<bool> targeted(code.size() + 1, false);
+	for (Instruction const& instruction : code)
+		if (jumpOf(instruction.op_) != Jump::NONE)
+			targeted[instruction.target_] = true;
+
+	// every old instruction that a jump may go to keeps its place in the new code
+	vector<Instruction> fused;
+	vector<size_t> moved(code.size() + 1, 0);
+
+	for (size_t i = 0; i < code.size();)
+	{
+		Instruction super;
+		size_t length = fuse(code, i, super);
+
+		for (size_t j = 1; j < length; ++j)
+			if (targeted[i + j])
+				length = 0;
+
+		moved[i] = fused.size();
+		if (length == 0)
+		{
+			fused.push_back(code[i++]);
+			continue;
+		}
+
+		fused.push_back(super);
+		i += length;
+	}
+	moved[code.size()] = fused.size();
+
+	if (fused.size() == code.size())
+		return;
+
+	vector<size_t> starts;
+	size_t size = 0;
+	for (Instruction const& instruction : fused)
+	{
+		starts.push_back(size);
+		size += 1 + 2 * instruction.count_;
+	}
+	starts.push_back(size);
+
+	// the code only shrinks, so every offset still fits in its operand
+	vector<uint8_t> bytes;
+	bytes.reserve(size);
+	for (size_t i = 0; i < fused.size(); ++i)
+	{
+		Instruction & instruction = fused[i];
+		Jump jump = jumpOf(instruction.op_);
+		if (jump != Jump::NONE)
+		{
+			size_t to = starts[moved[instruction.target_]];
+			instruction.operands_[instruction.count_ - 1] = static_cast<unsigned>(jump == Jump::FORWARD ? to - starts[i + 1] : starts[i + 1] - to);
+		}
+
+		bytes.push_back(static_cast<uint8_t>(instruction.op_));
+		for (unsigned j = 0; j < instruction.count_; ++j)
+		{
+			bytes.push_back(static_cast<uint8_t>(instruction.operands_[j] & 0xff));
+			bytes.push_back(static_cast<uint8_t>(instruction.operands_[j] >> 8));
+		}
+	}
+
+	chunk.code_ = std::move(bytes);
+}
+
+/**
+@name:		fuseSuperinstructions
+@purpose:	fuses the script and every function of a compiled program
+@param:		Program &
+@return:	void
+*/
+void fuseSuperinstructions(Program & program)
+{
+	fuseSuperinstructions(program.script_);
+	for (auto & function : program.functions_)
+		fuseSuperinstructions(function->chunk_);
+}
@@ -0,0 +1,17 @@
+/**	@file superinstructions.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the pass that fuses common instruction sequences of compiled loops into superinstructions
+*/
+
+#pragma once
+#include "bytecode.hpp"
+
+// A for-loop is desugared by the parser into a while-loop whose test and increment compile to the same few
+// instructions every time, such as "i < 10" and "i = i + 1". Each of these sequences is replaced by one
+// superinstruction that does the same work in a single dispatch, and the jumps around them are moved to
+// match. A sequence that some jump lands inside of is left alone.
+void fuseSuperinstructions(Chunk & chunk);
+void fuseSuperinstructions(Program & program);
@@ -7,30 +7,39 @@
 */
 
 #pragma once
+#include "token_kind.hpp"
+#include "ref.hpp"
 #include <memory>
 #include <vector>
 #include <map>
 #include <string>
 #include <tuple>
 
-#define DEF_POINTER_TYPE(type) using pointer_type = std::shared_ptr<type>;
+#define DEF_POINTER_TYPE(type) using pointer_type = Ref<type>;
 
+// gives a class its range of kinds, every subclass's kind falls inside its base's range
 #define DEF_IS_CONVERTIBLE_FROM(type)\
-	public: virtual bool is_convertible_from(Token::pointer_type const& ptr) const\
+	public: static constexpr TokenKind first_kind = TokenKind::type;\
+	static constexpr TokenKind last_kind = lastKindOf(TokenKind::type);\
+	virtual bool is_convertible_from(Token::pointer_type const& ptr) const\
 	{\
-		return dynamic_cast<type const*>(ptr.get()) != nullptr;\
+		return ptr && first_kind <= ptr->kind() && ptr->kind() <= last_kind;\
 	}
 
-class Token {
+class Token : public RefCounted {
 protected:
 	unsigned short lineNum_;
 	unsigned short indentNum_;
+	TokenKind kind_;	// set by the constructor of the most derived class
 public:
 	DEF_POINTER_TYPE(Token)
 	using string_type = std::string;
 
+	Token() : kind_(TokenKind::Token) {}
 	virtual string_type toString() const;
 
+	TokenKind kind() const { return kind_; }
+
 	unsigned short getLineNumber() { return lineNum_; }
 	unsigned short getIndentNumber() { return indentNum_; }
 	void setLineNumber(unsigned short line) { lineNum_ = line; }
@@ -64,11 +73,14 @@ inline bool operator==(Token::pointer_type const& lhs, Token::pointer_type const
 template<typename check_type, typename org_type>
 bool is(org_type const& tkn)
 {
-	return dynamic_cast<check_type const*>(tkn.get()) != nullptr;
+	return tkn && check_type::first_kind <= tkn->kind() && tkn->kind() <= check_type::last_kind;
 }
 
 template<typename convert_type>
 typename convert_type::pointer_type convert(Token::pointer_type const& tkn)
 {
-	return std::dynamic_pointer_cast<convert_type>(tkn);
+	if (!is<convert_type>(tkn))
+		return nullptr;
+
+	return static_pointer_cast<convert_type>(tkn);
 }
\ No newline at end of file
@@ -0,0 +1,172 @@
+/**	@file token_kind.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the kind tag carried by every token
+*/
+
+#pragma once
+
+/* One enumerator per Token class, listed in the same order as a depth-first walk of the
+   class hierarchy. Every subclass therefore falls between its base and lastKindOf(base),
+   so a hierarchy check is a range test. Keep this list in step with the classes. */
+enum class TokenKind : unsigned char
+{
+	Token,
+		Operand,
+			Number,
+				Integer,
+				Float,
+					Pi,
+					E,
+			Boolean,
+				True,
+				False,
+			Word,
+			Variable,
+		Operation,
+			Operator,
+				UnaryOperator,
+					NonAssocOperator,
+						Factorial,
+						Identity,
+						Negation,
+						Not,
+				BinaryOperator,
+					RAssocOperator,
+						Power,
+					LAssocOperator,
+						Addition,
+						Subtraction,
+						Multiplication,
+						Division,
+						Modulus,
+						And,
+						Nand,
+						Or,
+						Nor,
+						Xor,
+						Xnor,
+						Relational,
+							Equality,
+							Greater,
+							GreaterEqual,
+							Inequality,
+							Less,
+							LessEqual,
+		MiscOperators,
+			Brackets,
+				LeftBracket,
+				RightBracket,
+			Braces,
+				LeftBrace,
+				RightBrace,
+			ArgSeparator,
+			SemiColon,
+			Colon,
+			Comma,
+			Dot,
+		Assignment,
+		Keyword,
+			Var,
+				VarBool,
+				VarNumber,
+					VarInt,
+					VarFloat,
+				VarWord,
+				VarObject,
+				VarVoid,
+			Print,
+			If,
+			Else,
+			While,
+			For,
+			Do,
+			Func,
+			Return,
+			Class,
+			Me,
+			Inherits,
+			Super,
+			Data,
+			Method,
+		Expression,
+			AssignExpression,
+			BinaryExpression,
+			SetExpression,
+			MeExpression,
+			SuperExpression,
+			CallExpression,
+			GetExpression,
+			UnaryExpression,
+			GroupExpression,
+			LiteralExpression,
+			LogicalExpression,
+			VariableExpression,
+		Statement,
+			StmtBlock,
+			StmtExpression,
+			StmtFunc,
+			StmtClass,
+			StmtIf,
+			StmtWhile,
+			StmtDoWhile,
+			StmtPrint,
+			StmtReturn,
+			StmtVariable,
+		BetaCallable,
+			BetaClass,
+			CustomFunction,
+			Abs,
+			Arctan,
+			Cos,
+			Expo,
+			Log,
+			Rnd,
+			Sin,
+			Sqr,
+			Tan,
+			Pow,
+			DateTime,
+			DateTimeUTC,
+			Epoch,
+		BetaInstance,
+	NUM_KINDS
+};
+
+/**
+@name:		lastKindOf
+@purpose:	returns the last kind in the subtree rooted at a kind, which is the kind itself for leaf classes
+@param:		TokenKind
+@return:	TokenKind
+*/
+constexpr TokenKind lastKindOf(TokenKind kind)
+{
+	switch (kind)
+	{
+	case TokenKind::Token:				return TokenKind::BetaInstance;
+	case TokenKind::Operand:			return TokenKind::Variable;
+	case TokenKind::Number:				return TokenKind::E;
+	case TokenKind::Float:				return TokenKind::E;
+	case TokenKind::Boolean:			return TokenKind::False;
+	case TokenKind::Operation:			return TokenKind::LessEqual;
+	case TokenKind::Operator:			return TokenKind::LessEqual;
+	case TokenKind::UnaryOperator:		return TokenKind::Not;
+	case TokenKind::NonAssocOperator:	return TokenKind::Not;
+	case TokenKind::BinaryOperator:		return TokenKind::LessEqual;
+	case TokenKind::RAssocOperator:		return TokenKind::Power;
+	case TokenKind::LAssocOperator:		return TokenKind::LessEqual;
+	case TokenKind::Relational:			return TokenKind::LessEqual;
+	case TokenKind::MiscOperators:		return TokenKind::Dot;
+	case TokenKind::Brackets:			return TokenKind::RightBracket;
+	case TokenKind::Braces:				return TokenKind::RightBrace;
+	case TokenKind::Keyword:			return TokenKind::Method;
+	case TokenKind::Var:				return TokenKind::VarVoid;
+	case TokenKind::VarNumber:			return TokenKind::VarFloat;
+	case TokenKind::Expression:			return TokenKind::VariableExpression;
+	case TokenKind::Statement:			return TokenKind::StmtVariable;
+	case TokenKind::BetaCallable:		return TokenKind::Epoch;
+	default:							return kind;
+	}
+}
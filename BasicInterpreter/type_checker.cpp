@@ -0,0 +1,593 @@
+/**	@file type_checker.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of TypeChecker class
+*/
+
+#include "type_checker.hpp"
+#include "position_tracker.hpp"
+using namespace std;
+
+TypeChecker::TypeChecker(Interpreter * interpreter)
+{
+	curFunc_ = nullptr;
+	curInit_ = false;
+	result_ = StaticType::UNKNOWN;
+
+	// superglobal scope, which the program's own globals share as they do in the resolver
+	scopes_.push_back(Scope());
+	for (auto const& native : interpreter->nativeNames_)
+		declare(native, StaticType::UNKNOWN);
+}
+
+/**
+@name:		check
+@purpose:	checks the program's top-level statements, keeping the position tracker on the one being checked
+@param:		std::list<Statement::pointer_type> const &
+@return:	void
+*/
+void TypeChecker::check(std::list<Statement::pointer_type> const& statements)
+{
+	for (auto const& statement : statements)
+	{
+		check(statement);
+		++PositionTracker::itStmtPos_;
+	}
+}
+
+/**
+@name:		check
+@purpose:	checks a single statement
+@param:		Statement::pointer_type const &
+@return:	void
+*/
+void TypeChecker::check(Statement::pointer_type const& statement)
+{
+	statement->accept(*this);
+}
+
+/**
+@name:		check
+@purpose:	checks an expression and returns its type
+@param:		Expression::expr_type const &
+@return:	StaticType
+*/
+TypeChecker::StaticType TypeChecker::check(Expression::expr_type const& expr)
+{
+	expr->accept(*this);
+	return result_;
+}
+
+/**
+@name:		checkBlock
+@purpose:	checks the statements of a block or a function body in the current scope
+@param:		std::list<Statement::pointer_type> const &
+@return:	void
+*/
+void TypeChecker::checkBlock(std::list<Statement::pointer_type> const& statements)
+{
+	for (auto const& statement : statements)
+		check(statement);
+}
+
+/**
+@name:		checkFunction
+@purpose:	checks the body of a function or method, with its parameters and "me" in scope
+@param:		StmtFunc *, bool, bool
+@return:	void
+*/
+void TypeChecker::checkFunction(StmtFunc * func, bool isMethod, bool isInit)
+{
+	StmtFunc * parFunc = curFunc_;
+	bool parInit = curInit_;
+	curFunc_ = func;
+	curInit_ = isInit;
+
+	// cleared by the first return that cannot be proven
+	func->returnsChecked_ = true;
+
+	scopes_.push_back(Scope());
+	if (isMethod)
+		declare("me", StaticType::INSTANCE);
+
+	// arguments are checked when they are bound, so a parameter always holds its type
+	for (auto const& param : func->params_)
+		declare(param->toString(), staticType(convert<Variable>(param)->getType()));
+
+	checkBlock(func->body_);
+	scopes_.pop_back();
+
+	curFunc_ = parFunc;
+	curInit_ = parInit;
+}
+
+/**
+@name:		declare
+@purpose:	adds a name to the current scope
+@param:		std::string const &, StaticType, StmtFunc *
+@return:	void
+*/
+void TypeChecker::declare(std::string const& name, StaticType type, StmtFunc * func)
+{
+	scopes_.back()[name] = Binding{ type, func };
+}
+
+/**
+@name:		lookup
+@purpose:	finds the declaration a name refers to, which the resolver has already confirmed exists
+@param:		std::string const &
+@return:	Binding
+*/
+TypeChecker::Binding TypeChecker::lookup(std::string const& name) const
+{
+	for (auto itScope = scopes_.crbegin(); itScope != scopes_.crend(); ++itScope)
+	{
+		auto itBinding = itScope->find(name);
+		if (itBinding != itScope->end())
+			return itBinding->second;
+	}
+
+	return Binding{ StaticType::UNKNOWN, nullptr };
+}
+
+/**
+@name:		staticType
+@purpose:	returns the type of the values a declared type accepts
+@param:		VarType
+@return:	StaticType
+*/
+TypeChecker::StaticType TypeChecker::staticType(VarType type)
+{
+	switch (type)
+	{
+	case VarType::BOOL:		return StaticType::BOOL;
+	case VarType::NUMBER:	return StaticType::NUMBER;
+	case VarType::WORD:		return StaticType::WORD;
+	case VarType::OBJECT:	return StaticType::INSTANCE;
+	default:				return StaticType::UNKNOWN;
+	}
+}
+
+/**
+@name:		match
+@purpose:	tells whether a value of a known type always, never, or only sometimes suits a declared type,
+			following Interpreter::checkType
+@param:		VarType, StaticType
+@return:	Match
+*/
+TypeChecker::Match TypeChecker::match(VarType type, StaticType actual)
+{
+	if (actual == StaticType::UNKNOWN)
+		return Match::UNKNOWN;
+
+	// a known type is never null, so it cannot suit void
+	return staticType(type) == actual ? Match::PROVEN : Match::MISMATCH;
+}
+
+/**
+@name:		typeName
+@purpose:	returns a known type as a string
+@param:		StaticType
+@return:	std::string
+*/
+std::string TypeChecker::typeName(StaticType type)
+{
+	switch (type)
+	{
+	case StaticType::BOOL:		return "bool";
+	case StaticType::NUMBER:	return "number";
+	case StaticType::WORD:		return "word";
+	case StaticType::INSTANCE:	return "object";
+	default:					return "unknown";
+	}
+}
+
+/**
+@name:		binaryType
+@purpose:	returns the type a binary operator gives for operands of known types, following the operators' kernel tables
+@param:		BinaryExpression::oper_type const &, StaticType, StaticType
+@return:	StaticType
+*/
+TypeChecker::StaticType TypeChecker::binaryType(BinaryExpression::oper_type const& oper, StaticType left, StaticType right)
+{
+	// an object operand gives null rather than an error, and is left to the run like anything unknown
+	if (left == StaticType::UNKNOWN || right == StaticType::UNKNOWN || left == StaticType::INSTANCE || right == StaticType::INSTANCE)
+		return StaticType::UNKNOWN;
+
+	bool numbers = left == StaticType::NUMBER && right == StaticType::NUMBER;
+	bool booleans = left == StaticType::BOOL && right == StaticType::BOOL;
+
+	if (is<Addition>(oper))
+	{
+		if (left == StaticType::WORD || right == StaticType::WORD)
+			return StaticType::WORD;
+		if (booleans)
+			return StaticType::BOOL;
+	}
+	else if (is<Equality>(oper) || is<Inequality>(oper))
+		return numbers || booleans ? StaticType::BOOL : StaticType::UNKNOWN;
+	else if (is<Relational>(oper))
+		return numbers ? StaticType::BOOL : StaticType::UNKNOWN;
+	else if (is<And>(oper) || is<Nand>(oper) || is<Or>(oper) || is<Nor>(oper) || is<Xor>(oper) || is<Xnor>(oper))
+		return booleans ? StaticType::BOOL : StaticType::UNKNOWN;
+
+	// the arithmetic operators, including addition, give a number for two numbers
+	return numbers ? StaticType::NUMBER : StaticType::UNKNOWN;
+}
+
+/**
+@name:		unaryType
+@purpose:	returns the type a unary operator gives for an operand of a known type
+@param:		UnaryExpression::oper_type const &, StaticType
+@return:	StaticType
+*/
+TypeChecker::StaticType TypeChecker::unaryType(UnaryExpression::oper_type const& oper, StaticType operand)
+{
+	if (is<Not>(oper))
+		return operand == StaticType::BOOL ? StaticType::BOOL : StaticType::UNKNOWN;
+
+	return operand == StaticType::NUMBER ? StaticType::NUMBER : StaticType::UNKNOWN;
+}
+
+/**
+@name:		visit
+@purpose:	checks the value assigned to a variable against the variable's declared type
+@param:		AssignExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(AssignExpression * expr)
+{
+	StaticType actual = check(expr->expr_);
+	VarType type = expr->oper_->getType();
+
+	Match result = match(type, actual);
+	if (result == Match::MISMATCH)
+		throw TypeException("TypeException: Cannot assign a " + typeName(actual) + " to a " + Interpreter::VarTypeName(type));
+
+	expr->checked_ = result == Match::PROVEN;
+
+	// whatever is assigned has passed the check by the time the assignment gives it back
+	result_ = staticType(type);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	finds the type of a binary expression
+@param:		BinaryExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(BinaryExpression * expr)
+{
+	StaticType left = check(expr->left_);
+	StaticType right = check(expr->right_);
+	result_ = binaryType(expr->oper_, left, right);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	checks a call's arguments, which are proven against the parameters when the callee is a named function
+@param:		CallExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(CallExpression * expr)
+{
+	StmtFunc * func = nullptr;
+	if (is<VariableExpression>(expr->callee_))
+		func = lookup(static_cast<VariableExpression *>(expr->callee_.get())->oper_->getName()).func;
+	else
+		check(expr->callee_);
+
+	// a call with the wrong number of arguments fails before any is bound
+	if (func != nullptr && func->params_.size() != expr->args_.size())
+		func = nullptr;
+
+	auto itParam = func != nullptr ? func->params_.cbegin() : std::vector<Token::pointer_type>::const_iterator();
+	for (auto const& arg : expr->args_)
+	{
+		StaticType actual = check(arg);
+		if (func == nullptr)
+			continue;
+
+		VarType type = convert<Variable>(*itParam++)->getType();
+		Match result = match(type, actual);
+		if (result == Match::MISMATCH)
+			throw TypeException("TypeException: Cannot assign a " + typeName(actual) + " to a " + Interpreter::VarTypeName(type));
+
+		if (result == Match::UNKNOWN)
+			func->argsChecked_ = false;
+	}
+
+	// a function that falls off the end of its body gives null
+	result_ = StaticType::UNKNOWN;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	finds the type of a unary expression
+@param:		UnaryExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(UnaryExpression * expr)
+{
+	result_ = unaryType(expr->oper_, check(expr->exp_));
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	finds the type of a group expression
+@param:		GroupExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(GroupExpression * expr)
+{
+	check(expr->expr_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	finds the type of a literal
+@param:		LiteralExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(LiteralExpression * expr)
+{
+	if (expr->value_.isBool())
+		result_ = StaticType::BOOL;
+	else if (expr->value_.isNumber())
+		result_ = StaticType::NUMBER;
+	else if (expr->value_.isWord())
+		result_ = StaticType::WORD;
+	else
+		result_ = StaticType::UNKNOWN;
+
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	finds the type of a logical expression, which gives either its boolean left operand or its right one
+@param:		LogicalExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(LogicalExpression * expr)
+{
+	check(expr->left_);
+	result_ = check(expr->right_) == StaticType::BOOL ? StaticType::BOOL : StaticType::UNKNOWN;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	finds the type of a variable, a function used as anything but a callee may be called from anywhere
+@param:		VariableExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(VariableExpression * expr)
+{
+	Binding binding = lookup(expr->oper_->getName());
+	if (binding.func != nullptr)
+		binding.func->argsChecked_ = false;
+
+	result_ = binding.type;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	checks the object of a get expression, fields are not typed
+@param:		GetExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(GetExpression * expr)
+{
+	check(expr->obj_);
+	result_ = StaticType::UNKNOWN;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	checks the object and value of a set expression, which gives back the value
+@param:		SetExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(SetExpression * expr)
+{
+	check(expr->obj_);
+	check(expr->val_);
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	the "me" keyword is always an instance
+@param:		MeExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(MeExpression *)
+{
+	result_ = StaticType::INSTANCE;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	a "super" method is a function, which has no static type
+@param:		SuperExpression *
+@return:	Value
+*/
+Value TypeChecker::visit(SuperExpression *)
+{
+	result_ = StaticType::UNKNOWN;
+	return Value();
+}
+
+/**
+@name:		visit
+@purpose:	checks the expression of a generic expression statement
+@param:		StmtExpression *
+@return:	void
+*/
+void TypeChecker::visit(StmtExpression * expr)
+{
+	check(expr->expr_);
+}
+
+/**
+@name:		visit
+@purpose:	declares a function and checks its body
+@param:		StmtFunc *
+@return:	void
+*/
+void TypeChecker::visit(StmtFunc * expr)
+{
+	// a function's name may be reassigned an instance, so reading it gives no type, but it is a function whenever it can be called
+	declare(expr->ident_->getName(), StaticType::UNKNOWN, expr);
+
+	// cleared by the first use of the name that is not a call with proven arguments
+	expr->argsChecked_ = true;
+	checkFunction(expr, false, false);
+}
+
+/**
+@name:		visit
+@purpose:	checks the expression in a print statement
+@param:		StmtPrint *
+@return:	void
+*/
+void TypeChecker::visit(StmtPrint * expr)
+{
+	check(expr->expr_);
+}
+
+/**
+@name:		visit
+@purpose:	checks a returned value against the type of the function it returns from
+@param:		StmtReturn *
+@return:	void
+*/
+void TypeChecker::visit(StmtReturn * expr)
+{
+	// an init method gives back its instance, and the resolver allows it no returned value
+	if (curInit_)
+		return;
+
+	VarType type = curFunc_->ident_->getType();
+	Match result;
+	string returned = "nothing";
+	if (expr->expr_)
+	{
+		StaticType actual = check(expr->expr_);
+		result = match(type, actual);
+		returned = "a " + typeName(actual);
+	}
+	else
+		result = type == VarType::VOID_TYPE ? Match::PROVEN : Match::MISMATCH;
+
+	if (result == Match::MISMATCH)
+		throw TypeException("TypeException: Cannot return " + returned + " when expected type is " + Interpreter::VarTypeName(type));
+
+	if (result == Match::UNKNOWN)
+		curFunc_->returnsChecked_ = false;
+}
+
+/**
+@name:		visit
+@purpose:	checks a variable's initializer against its declared type
+@param:		StmtVariable *
+@return:	void
+*/
+void TypeChecker::visit(StmtVariable * expr)
+{
+	VarType type = expr->var_->getType();
+
+	// a variable without an initializer holds null until it is assigned
+	StaticType held = StaticType::UNKNOWN;
+	if (expr->expr_ != nullptr)
+	{
+		StaticType actual = check(expr->expr_);
+		Match result = match(type, actual);
+		if (result == Match::MISMATCH)
+			throw TypeException("TypeException: Cannot assign a " + typeName(actual) + " to a " + Interpreter::VarTypeName(type));
+
+		expr->checked_ = result == Match::PROVEN;
+		held = staticType(type);
+	}
+
+	declare(expr->var_->getName(), held);
+}
+
+/**
+@name:		visit
+@purpose:	checks the statements of a block in a scope of their own
+@param:		StmtBlock *
+@return:	void
+*/
+void TypeChecker::visit(StmtBlock * expr)
+{
+	scopes_.push_back(Scope());
+	checkBlock(expr->statements_);
+	scopes_.pop_back();
+}
+
+/**
+@name:		visit
+@purpose:	declares a class and checks its methods
+@param:		StmtClass *
+@return:	void
+*/
+void TypeChecker::visit(StmtClass * expr)
+{
+	declare(expr->name_->getName(), StaticType::UNKNOWN);
+
+	if (expr->super_ != nullptr)
+		check(expr->super_);
+
+	// methods are called on instances, whose class is only known at runtime, so their arguments are always checked
+	for (auto const& method : expr->methods_)
+		checkFunction(&*method, true, method->ident_->getName() == "init");
+}
+
+/**
+@name:		visit
+@purpose:	checks an if-statement's condition, block statement, and else statement
+@param:		StmtIf *
+@return:	void
+*/
+void TypeChecker::visit(StmtIf * expr)
+{
+	check(expr->expr_);
+	check(expr->thenBlock_);
+	if (expr->elseBlock_) check(expr->elseBlock_);
+}
+
+/**
+@name:		visit
+@purpose:	checks a while statement's condition and block statement
+@param:		StmtWhile *
+@return:	void
+*/
+void TypeChecker::visit(StmtWhile * expr)
+{
+	check(expr->expr_);
+	check(expr->whileBlock_);
+}
+
+/**
+@name:		visit
+@purpose:	checks a do while-statement's condition and block statement
+@param:		StmtDoWhile *
+@return:	void
+*/
+void TypeChecker::visit(StmtDoWhile * expr)
+{
+	check(expr->expr_);
+	check(expr->whileBlock_);
+}
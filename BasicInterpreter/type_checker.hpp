@@ -0,0 +1,85 @@
+/**	@file type_checker.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the type checker, which rejects assignments, arguments, and returns
+			that can never suit their declared types, and marks the ones that always do
+*/
+
+#pragma once
+#include "interpreter.hpp"
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+class TypeChecker : public ExprVisitor, public StmtVisitor
+{
+public:
+	class TypeException : public std::exception
+	{
+	public:
+		TypeException(std::string msg) : std::exception(msg.c_str()) {}
+	};
+private:
+	// what is known about a value before the program runs, UNKNOWN when it may be null or its type depends
+	// on something only the run can tell, such as what a call returns
+	enum class StaticType { UNKNOWN, BOOL, NUMBER, WORD, INSTANCE };
+	enum class Match { PROVEN, UNKNOWN, MISMATCH };
+
+	struct Binding
+	{
+		StaticType type;	// what every read of the name gives
+		StmtFunc * func;	// the declaration when the name is a function's, null otherwise
+	};
+	using Scope = std::map<std::string, Binding>;
+
+	std::vector<Scope> scopes_;
+	StmtFunc * curFunc_;		// function whose body is being checked, null at the top level
+	bool curInit_;				// the function is an init method, whose returns are never checked
+	StaticType result_;			// type of the expression checked last
+
+public:
+	TypeChecker(Interpreter * interpreter);
+	void check(std::list<Statement::pointer_type> const& statements);
+
+private:
+	void check(Statement::pointer_type const& statement);
+	StaticType check(Expression::expr_type const& expr);
+	void checkBlock(std::list<Statement::pointer_type> const& statements);
+	void checkFunction(StmtFunc * func, bool isMethod, bool isInit);
+	void declare(std::string const& name, StaticType type, StmtFunc * func = nullptr);
+	Binding lookup(std::string const& name) const;
+
+	static StaticType staticType(VarType type);
+	static Match match(VarType type, StaticType actual);
+	static std::string typeName(StaticType type);
+	static StaticType binaryType(BinaryExpression::oper_type const& oper, StaticType left, StaticType right);
+	static StaticType unaryType(UnaryExpression::oper_type const& oper, StaticType operand);
+
+public:
+	virtual Value visit(AssignExpression * expr) override;
+	virtual Value visit(BinaryExpression * expr) override;
+	virtual Value visit(CallExpression * expr) override;
+	virtual Value visit(UnaryExpression * expr) override;
+	virtual Value visit(GroupExpression * expr) override;
+	virtual Value visit(LiteralExpression * expr) override;
+	virtual Value visit(LogicalExpression * expr) override;
+	virtual Value visit(VariableExpression * expr) override;
+	virtual Value visit(GetExpression * expr) override;
+	virtual Value visit(SetExpression * expr) override;
+	virtual Value visit(MeExpression * expr) override;
+	virtual Value visit(SuperExpression * expr) override;
+
+	virtual void visit(StmtExpression * expr) override;
+	virtual void visit(StmtFunc * expr) override;
+	virtual void visit(StmtPrint * expr) override;
+	virtual void visit(StmtReturn * expr) override;
+	virtual void visit(StmtVariable * expr) override;
+	virtual void visit(StmtBlock * expr) override;
+	virtual void visit(StmtClass * expr) override;
+	virtual void visit(StmtIf * expr) override;
+	virtual void visit(StmtWhile * expr) override;
+	virtual void visit(StmtDoWhile * expr) override;
+};
@@ -0,0 +1,197 @@
+/**	@file value.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of Value class
+*/
+
+#include "value.hpp"
+#include "nursery.hpp"
+#include <limits>
+#include <string>
+
+/**
+@name:		Value
+@purpose:	stores an integer inline if it fits in 64 bits, otherwise keeps a reference to an Integer
+@param:		Integer::value_type const &
+@return:	Value
+*/
+Value::Value(Integer::value_type const& value) : kind_(Kind::INT), int_(0)
+{
+	if (value >= (std::numeric_limits<std::int64_t>::min)() && value <= (std::numeric_limits<std::int64_t>::max)())
+		int_ = static_cast<std::int64_t>(value);
+	else
+		ref_ = Nursery::get().make<Integer>(value);
+}
+
+/**
+@name:		Value
+@purpose:	stores a native float inline, otherwise keeps a reference to a new Float
+@param:		Float::value_type const &
+@return:	Value
+*/
+Value::Value(Float::value_type const& value) : kind_(Kind::FLOAT), int_(0)
+{
+	if constexpr (Float::is_native)
+		float_ = static_cast<double>(value);
+	else
+		ref_ = Nursery::get().make<Float>(value);
+}
+
+/**
+@name:		Value
+@purpose:	keeps a reference to a new Word
+@param:		Word::value_type const &
+@return:	Value
+*/
+Value::Value(Word::value_type const& value) : kind_(Kind::WORD), int_(0), ref_(Nursery::get().make<Word>(value)) {}
+
+/**
+@name:		Value
+@purpose:	wraps an existing token, unboxing booleans and small integers
+@param:		Token::pointer_type const &
+@return:	Value
+*/
+Value::Value(Token::pointer_type const& tok) : kind_(Kind::NIL), int_(0)
+{
+	if (!tok)
+		return;
+
+	if (is<Boolean>(tok))
+	{
+		kind_ = Kind::BOOL;
+		bool_ = getValue<Boolean>(tok);
+	}
+	else if (is<Integer>(tok))
+	{
+		*this = Value(getValue<Integer>(tok));
+	}
+	else if (is<Float>(tok))
+	{
+		*this = Value(getValue<Float>(tok));
+	}
+	else if (is<Word>(tok))
+	{
+		kind_ = Kind::WORD;
+		ref_ = tok;
+	}
+	else
+	{
+		kind_ = Kind::OBJECT;
+		ref_ = tok;
+	}
+}
+
+/**
+@name:		toInteger
+@purpose:	returns the value of an integer as an arbitrary-precision integer
+@param:		null
+@return:	Integer::value_type
+*/
+Integer::value_type Value::toInteger() const
+{
+	if (ref_)
+		return getValue<Integer>(ref_);
+
+	return Integer::value_type(int_);
+}
+
+/**
+@name:		toFloat
+@purpose:	returns the value of a number as a float, converting integers if necessary
+@param:		null
+@return:	Float::value_type
+*/
+Float::value_type Value::toFloat() const
+{
+	if (kind_ == Kind::FLOAT)
+	{
+		if constexpr (Float::is_native)
+			return float_;
+		else
+			return getValue<Float>(ref_);
+	}
+
+	if (!ref_)
+		return static_cast<Float::value_type>(int_);
+
+	return static_cast<Float::value_type>(toInteger());
+}
+
+/**
+@name:		asWord
+@purpose:	returns the text of a word
+@param:		null
+@return:	Word::value_type const &
+*/
+Word::value_type const& Value::asWord() const
+{
+	return static_cast<Word const*>(ref_.get())->getValue();
+}
+
+/**
+@name:		promote
+@purpose:	moves a young word or number to the general heap before it is stored somewhere long-lived
+@param:		null
+@return:	void
+*/
+void Value::promote()
+{
+	if (!ref_ || kind_ == Kind::OBJECT || !Nursery::get().isYoung(ref_.get()))
+		return;
+
+	// words and numbers never change, so a copy can stand in for the young one
+	if (kind_ == Kind::WORD && ref_.use_count() == 1)
+		ref_.reset(new Word(std::move(static_cast<Word *>(ref_.get())->value_)));
+	else if (kind_ == Kind::WORD)
+		ref_.reset(new Word(asWord()));
+	else if (kind_ == Kind::INT)
+		ref_.reset(new Integer(getValue<Integer>(ref_)));
+	else
+		ref_.reset(new Float(getValue<Float>(ref_)));
+}
+
+/**
+@name:		typeName
+@purpose:	returns the name of the value's type, used in error messages
+@param:		null
+@return:	string_type
+*/
+Value::string_type Value::typeName() const
+{
+	switch (kind_)
+	{
+	case Kind::BOOL:	return "Boolean";
+	case Kind::INT:		return "Integer";
+	case Kind::FLOAT:	return "Float";
+	case Kind::WORD:	return "Word";
+	case Kind::OBJECT:	return ref_->toString();
+	default:			return "null";
+	}
+}
+
+/**
+@name:		toString
+@purpose:	returns the value as a string
+@param:		null
+@return:	string_type
+*/
+Value::string_type Value::toString() const
+{
+	switch (kind_)
+	{
+	case Kind::NIL:
+		return "null";
+	case Kind::BOOL:
+		return bool_ ? "true" : "false";
+	case Kind::INT:
+		if (!ref_)
+			return std::to_string(int_);
+		return ref_->toString();
+	case Kind::FLOAT:
+		return Float::format(toFloat());
+	default:
+		return ref_->toString();
+	}
+}
@@ -0,0 +1,64 @@
+/**	@file value.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the runtime value produced by every evaluated expression
+*/
+
+#pragma once
+#include "integer.hpp"
+#include "float.hpp"
+#include "boolean.hpp"
+#include "word.hpp"
+#include <cstdint>
+
+// Booleans, integers that fit in 64 bits and native floats are stored inline, everything else is held by reference
+class Value
+{
+public:
+	enum class Kind : unsigned char { NIL, BOOL, INT, FLOAT, WORD, OBJECT };
+	using string_type = Token::string_type;
+private:
+	Kind kind_;
+	union
+	{
+		bool bool_;
+		std::int64_t int_;
+		double float_;
+	};
+	Token::pointer_type ref_;
+public:
+	Value() : kind_(Kind::NIL), int_(0) {}
+	Value(std::nullptr_t) : kind_(Kind::NIL), int_(0) {}
+	explicit Value(bool value) : kind_(Kind::BOOL), int_(0) { bool_ = value; }
+	explicit Value(std::int64_t value) : kind_(Kind::INT), int_(value) {}
+	explicit Value(Integer::value_type const& value);
+	explicit Value(Float::value_type const& value);
+	explicit Value(Word::value_type const& value);
+	explicit Value(Token::pointer_type const& tok);
+
+	Kind kind() const { return kind_; }
+	bool isNil() const { return kind_ == Kind::NIL; }
+	bool isBool() const { return kind_ == Kind::BOOL; }
+	bool isInt() const { return kind_ == Kind::INT; }
+	bool isFloat() const { return kind_ == Kind::FLOAT; }
+	bool isNumber() const { return kind_ == Kind::INT || kind_ == Kind::FLOAT; }
+	bool isWord() const { return kind_ == Kind::WORD; }
+	bool isObject() const { return kind_ == Kind::OBJECT; }
+	bool isSmallInt() const { return kind_ == Kind::INT && !ref_; }
+
+	bool asBool() const { return bool_; }
+	std::int64_t asSmallInt() const { return int_; }
+	Integer::value_type toInteger() const;
+	Float::value_type toFloat() const;
+	Word::value_type const& asWord() const;
+	Token::pointer_type const& ref() const { return ref_; }
+	void promote();
+
+	template <typename T>
+	typename T::pointer_type as() const { return convert<T>(ref_); }
+
+	string_type typeName() const;
+	string_type toString() const;
+};
@@ -31,7 +31,7 @@ private:
 	value_type name_;
 	VarType varType_;
 public:
-	Variable(value_type value = "") : name_(value) {}
+	Variable(value_type value = "") : name_(value) { kind_ = first_kind; }
 	
 	void setName(string_type name) { name_ = name; }
 	string_type getName() const { return name_; }
@@ -12,18 +12,18 @@
 class ExprVisitor
 {
 public:
-	virtual Token::pointer_type visit(AssignExpression * expr) = 0;
-	virtual Token::pointer_type visit(BinaryExpression * expr) = 0;
-	virtual Token::pointer_type visit(CallExpression * expr) = 0;
-	virtual Token::pointer_type visit(UnaryExpression * expr) = 0;
-	virtual Token::pointer_type visit(GroupExpression * expr) = 0;
-	virtual Token::pointer_type visit(LiteralExpression * expr) = 0;
-	virtual Token::pointer_type visit(LogicalExpression * expr) = 0;
-	virtual Token::pointer_type visit(VariableExpression * expr) = 0;
-	virtual Token::pointer_type visit(GetExpression * expr) = 0;
-	virtual Token::pointer_type visit(SetExpression * expr) = 0;
-	virtual Token::pointer_type visit(MeExpression * expr) = 0;
-	virtual Token::pointer_type visit(SuperExpression * expr) = 0;
+	virtual Value visit(AssignExpression * expr) = 0;
+	virtual Value visit(BinaryExpression * expr) = 0;
+	virtual Value visit(CallExpression * expr) = 0;
+	virtual Value visit(UnaryExpression * expr) = 0;
+	virtual Value visit(GroupExpression * expr) = 0;
+	virtual Value visit(LiteralExpression * expr) = 0;
+	virtual Value visit(LogicalExpression * expr) = 0;
+	virtual Value visit(VariableExpression * expr) = 0;
+	virtual Value visit(GetExpression * expr) = 0;
+	virtual Value visit(SetExpression * expr) = 0;
+	virtual Value visit(MeExpression * expr) = 0;
+	virtual Value visit(SuperExpression * expr) = 0;
 };
 
 class StmtVisitor
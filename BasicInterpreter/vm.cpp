@@ -0,0 +1,777 @@
+/**	@file vm.cpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif implementation of VM class
+*/
+
+#include "vm.hpp"
+#include "interpreter.hpp"
+#include "beta_class.hpp"
+#include "beta_instance.hpp"
+#include "position_tracker.hpp"
+#include "fast_path.hpp"
+#include <iostream>
+#include <map>
+#include <sstream>
+using namespace std;
+
+// With GCC or Clang every handler jumps straight to the next instruction's handler through a table of
+// label addresses, so each one has its own indirect branch for the processor to predict. Other compilers,
+// or a build that defines BILBY_SWITCH_DISPATCH, go back through a switch for every instruction. A computed
+// goto does not destroy the locals of the scopes it leaves, so a handler's locals live in a block that
+// ends before its NEXT().
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(BILBY_SWITCH_DISPATCH)
+#define BILBY_THREADED_DISPATCH
+#define DISPATCH()		goto *handlers[*ip++]
+#define HANDLER(op)		handle_##op
+#define NEXT()			DISPATCH()
+#else
+#define HANDLER(op)		case OpCode::op
+#define NEXT()			break
+#endif
+
+/**
+@name:		readShort
+@purpose:	reads a 16-bit operand and moves past it
+@param:		std::uint8_t const *&
+@return:	unsigned
+*/
+static inline unsigned readShort(uint8_t const*& ip)
+{
+	unsigned operand = ip[0] | (ip[1] << 8);
+	ip += 2;
+	return operand;
+}
+
+/**
+@name:		compare
+@purpose:	performs the comparison a superinstruction was fused from, on the integer fast path when it can
+@param:		OpCode, Value const &, Value const &
+@return:	Value
+*/
+static Value compare(OpCode op, Value const& first, Value const& second)
+{
+	if (first.isSmallInt() && second.isSmallInt())
+	{
+		int64_t a = first.asSmallInt(), b = second.asSmallInt();
+		switch (op)
+		{
+		case OpCode::EQUAL:			return Value(a == b);
+		case OpCode::NOT_EQUAL:		return Value(a != b);
+		case OpCode::GREATER:		return Value(a > b);
+		case OpCode::GREATER_EQUAL:	return Value(a >= b);
+		case OpCode::LESS:			return Value(a < b);
+		default:					return Value(a <= b);
+		}
+	}
+
+	static Equality equality;
+	static Inequality inequality;
+	static Greater greater;
+	static GreaterEqual greaterEqual;
+	static Less less;
+	static LessEqual lessEqual;
+
+	switch (op)
+	{
+	case OpCode::EQUAL:			return equality.Equality::perform(first, second);
+	case OpCode::NOT_EQUAL:		return inequality.Inequality::perform(first, second);
+	case OpCode::GREATER:		return greater.Greater::perform(first, second);
+	case OpCode::GREATER_EQUAL:	return greaterEqual.GreaterEqual::perform(first, second);
+	case OpCode::LESS:			return less.Less::perform(first, second);
+	default:					return lessEqual.LessEqual::perform(first, second);
+	}
+}
+
+/**
+@name:		increment
+@purpose:	adds a constant to a variable's value for a fused increment, on the integer fast path when it can
+@param:		Value const &, Value const &
+@return:	Value
+*/
+static Value increment(Value const& var, Value const& step)
+{
+	Value sum = runBinaryPath(BinaryPath::INT_ADD, var, step);
+	if (!sum.isNil())
+		return sum;
+
+	static Addition op;
+	return op.Addition::perform(var, step);
+}
+
+/**
+@name:		checkAssignment
+@purpose:	throws if a value cannot be assigned to a variable of a type
+@param:		VarType, Value const &
+@return:	void
+*/
+static void checkAssignment(VarType type, Value const& val)
+{
+	if (!Interpreter::checkType(type, val))
+		throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + val.toString() + "\" to a " + Interpreter::VarTypeName(type)).c_str());
+}
+
+/**
+@name:		conditionError
+@purpose:	returns the message the interpreter gives for a non-boolean condition in a statement
+@param:		Condition
+@return:	char const *
+*/
+static char const* conditionError(Condition cond)
+{
+	switch (cond)
+	{
+	case Condition::IF:		return "InterpreterException: If-Statement condition must evaluate to true or false.";
+	case Condition::WHILE:	return "While-loop condition must evaluate to true or false.";
+	default:				return "Do-While loop condition must evaluate to true or false.";
+	}
+}
+
+VM::VM(Environment::pointer_type globals) : program_(nullptr), globals_(globals) {}
+
+/**
+@name:		run
+@purpose:	executes a compiled program, starting in the global environment
+@param:		Program const &
+@return:	void
+*/
+void VM::run(Program const& program)
+{
+	program_ = &program;
+	stack_.clear();
+	frames_.clear();
+
+	pool_.release(0);
+
+	frames_.push_back(CallFrame{ nullptr, &program.script_, program.script_.code_.data(), globals_, 0, Value(), 0 });
+	execute();
+
+	frames_.clear();
+	program_ = nullptr;
+}
+
+/**
+@name:		execute
+@purpose:	the dispatch loop, runs until the script halts
+@param:		null
+@return:	void
+*/
+void VM::execute()
+{
+	CallFrame * frame = &frames_.back();
+	uint8_t const * ip = frame->ip_;
+
+#if defined(BILBY_THREADED_DISPATCH)
+	// in the order of OpCode
+	static void * const handlers[] = {
+		&&handle_CONSTANT, &&handle_NIL, &&handle_POP, &&handle_GET_LOCAL,
+		&&handle_SET_LOCAL, &&handle_GET_GLOBAL, &&handle_SET_GLOBAL, &&handle_DEFINE,
+		&&handle_CHECK_TYPE, &&handle_BEGIN_SCOPE, &&handle_END_SCOPE, &&handle_BEGIN_FRAME,
+		&&handle_END_FRAME, &&handle_GET_PROPERTY, &&handle_CHECK_INSTANCE, &&handle_SET_PROPERTY,
+		&&handle_GET_SUPER, &&handle_GET_METHOD, &&handle_POWER, &&handle_ADD,
+		&&handle_SUBTRACT, &&handle_MULTIPLY, &&handle_DIVIDE, &&handle_MODULUS,
+		&&handle_AND, &&handle_NAND, &&handle_OR, &&handle_NOR,
+		&&handle_XOR, &&handle_XNOR, &&handle_EQUAL, &&handle_NOT_EQUAL,
+		&&handle_GREATER, &&handle_GREATER_EQUAL, &&handle_LESS, &&handle_LESS_EQUAL,
+		&&handle_FACTORIAL, &&handle_IDENTITY, &&handle_NEGATE, &&handle_NOT,
+		&&handle_JUMP, &&handle_JUMP_IF_FALSE, &&handle_LOOP, &&handle_LOOP_IF_TRUE,
+		&&handle_AND_THEN, &&handle_OR_ELSE, &&handle_JUMP_UNLESS_LOCAL_CONST, &&handle_JUMP_UNLESS_GLOBAL_CONST,
+		&&handle_ADD_LOCAL_CONST, &&handle_ADD_GLOBAL_CONST, &&handle_ADD_LOCAL_CONST_CHECKED, &&handle_ADD_GLOBAL_CONST_CHECKED,
+		&&handle_CHECK_CALLABLE, &&handle_CALL, &&handle_INVOKE, &&handle_CLOSURE,
+		&&handle_INHERIT, &&handle_CLASS, &&handle_RETURN, &&handle_LEAVE,
+		&&handle_PRINT, &&handle_NEXT_STATEMENT, &&handle_HALT
+	};
+	static_assert(sizeof(handlers) / sizeof(handlers[0]) == static_cast<size_t>(OpCode::HALT) + 1, "every opcode needs a handler");
+#endif
+
+	for (;;)
+	{
+#if defined(BILBY_THREADED_DISPATCH)
+		DISPATCH();
+#else
+		switch (static_cast<OpCode>(*ip++))
+#endif
+		{
+		HANDLER(CONSTANT):
+			stack_.push_back(frame->chunk_->constants_[readShort(ip)]);
+			NEXT();
+		HANDLER(NIL):
+			stack_.emplace_back();
+			NEXT();
+		HANDLER(POP):
+			stack_.pop_back();
+			NEXT();
+		HANDLER(GET_LOCAL):
+		{
+			unsigned depth = readShort(ip);
+			stack_.push_back(frame->env_->getAt(depth, readShort(ip)));
+		}
+		NEXT();
+		HANDLER(SET_LOCAL):
+		{
+			unsigned depth = readShort(ip);
+			frame->env_->reassignAt(depth, readShort(ip), stack_.back());
+		}
+		NEXT();
+		HANDLER(GET_GLOBAL):
+			stack_.push_back(globals_->get(readShort(ip)));
+			NEXT();
+		HANDLER(SET_GLOBAL):
+			globals_->define(readShort(ip), stack_.back());
+			NEXT();
+		HANDLER(DEFINE):
+		{
+			unsigned slot = readShort(ip);
+			frame->env_->define(slot, pop());
+		}
+		NEXT();
+		HANDLER(CHECK_TYPE):
+			checkAssignment(static_cast<VarType>(readShort(ip)), stack_.back());
+			NEXT();
+		HANDLER(BEGIN_SCOPE):
+			frame->env_ = Heap::get().make<Environment>(frame->env_, readShort(ip));
+			NEXT();
+		HANDLER(END_SCOPE):
+			frame->env_ = frame->env_->parent_;
+			NEXT();
+		HANDLER(BEGIN_FRAME):
+			frame->env_ = pool_.acquire(frame->env_, readShort(ip));
+			NEXT();
+		HANDLER(END_FRAME):
+			// the block's environment is the most recent one in the pool
+			frame->env_ = frame->env_->parent_;
+			pool_.release(pool_.mark() - 1);
+			NEXT();
+		HANDLER(GET_PROPERTY):
+		{
+			string const& name = frame->chunk_->names_[readShort(ip)];
+			PropertyCache& cache = frame->chunk_->caches_[readShort(ip)];
+			BetaInstance::pointer_type instance = instanceOf(stack_.back(), name);
+
+			PropertyCache::Entry const * entry = cache.lookup(instance->getClass(), name);
+			if (entry == nullptr)
+				stack_.back() = instance->get(name);	// reports the undefined property
+			else if (entry->offset_ >= 0)
+				stack_.back() = instance->getField(entry->offset_);
+			else
+				stack_.back() = Value(entry->method_->bind(instance));
+		}
+		NEXT();
+		HANDLER(CHECK_INSTANCE):
+		{
+			Value const& obj = stack_.back();
+			if (!obj.isObject() || !is<BetaInstance>(obj.ref()))
+			{
+				stringstream ss;
+				ss << "InterpreterException: " << "\"" << obj.toString() << "\" is not an object.";
+				throw Interpreter::InterpreterException(ss.str().c_str());
+			}
+		}
+		NEXT();
+		HANDLER(SET_PROPERTY):
+		{
+			string const& name = frame->chunk_->names_[readShort(ip)];
+			PropertyCache& cache = frame->chunk_->caches_[readShort(ip)];
+			Value val = pop();
+			BetaInstance::pointer_type instance = stack_.back().as<BetaInstance>();
+
+			PropertyCache::Entry const * entry = cache.lookup(instance->getClass(), name);
+			if (entry == nullptr || entry->offset_ < 0)
+				instance->set(name, val);		// reports the missing field
+			else
+				instance->setField(entry->offset_, val);
+			stack_.back() = val;
+		}
+		NEXT();
+		HANDLER(GET_METHOD):
+		{
+			string const& name = frame->chunk_->names_[readShort(ip)];
+			PropertyCache& cache = frame->chunk_->caches_[readShort(ip)];
+			BetaInstance::pointer_type instance = instanceOf(stack_.back(), name);
+
+			PropertyCache::Entry const * entry = cache.lookup(instance->getClass(), name);
+			if (entry != nullptr && entry->offset_ < 0)
+			{
+				stack_.back() = Value(CustomFunction::pointer_type(entry->method_));
+				stack_.push_back(Value(instance));
+			}
+			else
+			{
+				// a field holding a function is called like any other value
+				stack_.back() = entry == nullptr ? instance->get(name) : instance->getField(entry->offset_);
+				checkCallable(stack_.back());
+				stack_.emplace_back();
+			}
+		}
+		NEXT();
+		HANDLER(GET_SUPER):
+		{
+			unsigned depth = readShort(ip);
+			string const& name = frame->chunk_->names_[readShort(ip)];
+			BetaClass::pointer_type super = frame->env_->getAt(depth, 0).as<BetaClass>();
+
+			// the class instance is always one scope below super
+			BetaInstance::pointer_type obj = frame->env_->getAt(depth - 1, 0).as<BetaInstance>();
+			CustomFunction::pointer_type method = super->findMethod(obj, name);
+
+			if (method == nullptr)
+			{
+				stringstream ss;
+				ss << "InterpreterException: \"" << name << "\" is undefined.";
+				throw Interpreter::InterpreterException(ss.str().c_str());
+			}
+
+			stack_.push_back(Value(method));
+		}
+		NEXT();
+
+		HANDLER(POWER):			binary<Power>(); NEXT();
+		HANDLER(ADD):			binary<Addition>(); NEXT();
+		HANDLER(SUBTRACT):		binary<Subtraction>(); NEXT();
+		HANDLER(MULTIPLY):		binary<Multiplication>(); NEXT();
+		HANDLER(DIVIDE):		binary<Division>(); NEXT();
+		HANDLER(MODULUS):		binary<Modulus>(); NEXT();
+		HANDLER(AND):			binary<And>(); NEXT();
+		HANDLER(NAND):			binary<Nand>(); NEXT();
+		HANDLER(OR):			binary<Or>(); NEXT();
+		HANDLER(NOR):			binary<Nor>(); NEXT();
+		HANDLER(XOR):			binary<Xor>(); NEXT();
+		HANDLER(XNOR):			binary<Xnor>(); NEXT();
+		HANDLER(EQUAL):			binary<Equality>(); NEXT();
+		HANDLER(NOT_EQUAL):		binary<Inequality>(); NEXT();
+		HANDLER(GREATER):		binary<Greater>(); NEXT();
+		HANDLER(GREATER_EQUAL):	binary<GreaterEqual>(); NEXT();
+		HANDLER(LESS):			binary<Less>(); NEXT();
+		HANDLER(LESS_EQUAL):	binary<LessEqual>(); NEXT();
+		HANDLER(FACTORIAL):		unary<Factorial>(); NEXT();
+		HANDLER(IDENTITY):		unary<Identity>(); NEXT();
+		HANDLER(NEGATE):		unary<Negation>(); NEXT();
+		HANDLER(NOT):			unary<Not>(); NEXT();
+
+		HANDLER(JUMP):
+		{
+			unsigned offset = readShort(ip);
+			ip += offset;
+		}
+		NEXT();
+		HANDLER(JUMP_IF_FALSE):
+		{
+			Condition cond = static_cast<Condition>(readShort(ip));
+			unsigned offset = readShort(ip);
+			Value val = pop();
+
+			if (!val.isBool())
+				throw Interpreter::InterpreterException(conditionError(cond));
+			if (!val.asBool())
+				ip += offset;
+		}
+		NEXT();
+		HANDLER(LOOP):
+		{
+			unsigned offset = readShort(ip);
+			ip -= offset;
+		}
+		NEXT();
+		HANDLER(LOOP_IF_TRUE):
+		{
+			Condition cond = static_cast<Condition>(readShort(ip));
+			unsigned offset = readShort(ip);
+			Value val = pop();
+
+			if (!val.isBool())
+				throw Interpreter::InterpreterException(conditionError(cond));
+			if (val.asBool())
+				ip -= offset;
+		}
+		NEXT();
+		HANDLER(AND_THEN):
+		HANDLER(OR_ELSE):
+		{
+			// an And whose left side is false, or an Or whose left side is true, is already decided
+			bool decidedBy = static_cast<OpCode>(ip[-1]) == OpCode::OR_ELSE;
+			unsigned offset = readShort(ip);
+
+			if (!stack_.back().isBool())
+				throw Interpreter::InterpreterException("Condition must evaluate to true or false.");
+
+			if (stack_.back().asBool() == decidedBy)
+				ip += offset;
+			else
+				stack_.pop_back();
+		}
+		NEXT();
+
+		HANDLER(JUMP_UNLESS_LOCAL_CONST):
+		{
+			OpCode op = static_cast<OpCode>(readShort(ip));
+			Condition cond = static_cast<Condition>(readShort(ip));
+			unsigned depth = readShort(ip);
+			Value const& var = frame->env_->getAt(depth, readShort(ip));
+			Value const& constant = frame->chunk_->constants_[readShort(ip)];
+			unsigned offset = readShort(ip);
+			Value val = compare(op, var, constant);
+
+			if (!val.isBool())
+				throw Interpreter::InterpreterException(conditionError(cond));
+			if (!val.asBool())
+				ip += offset;
+		}
+		NEXT();
+		HANDLER(JUMP_UNLESS_GLOBAL_CONST):
+		{
+			OpCode op = static_cast<OpCode>(readShort(ip));
+			Condition cond = static_cast<Condition>(readShort(ip));
+			Value const& var = globals_->get(readShort(ip));
+			Value const& constant = frame->chunk_->constants_[readShort(ip)];
+			unsigned offset = readShort(ip);
+			Value val = compare(op, var, constant);
+
+			if (!val.isBool())
+				throw Interpreter::InterpreterException(conditionError(cond));
+			if (!val.asBool())
+				ip += offset;
+		}
+		NEXT();
+		HANDLER(ADD_LOCAL_CONST):
+		{
+			unsigned depth = readShort(ip);
+			unsigned slot = readShort(ip);
+			Value sum = increment(frame->env_->getAt(depth, slot), frame->chunk_->constants_[readShort(ip)]);
+			frame->env_->reassignAt(depth, slot, sum);
+		}
+		NEXT();
+		HANDLER(ADD_GLOBAL_CONST):
+		{
+			unsigned slot = readShort(ip);
+			globals_->define(slot, increment(globals_->get(slot), frame->chunk_->constants_[readShort(ip)]));
+		}
+		NEXT();
+		HANDLER(ADD_LOCAL_CONST_CHECKED):
+		{
+			unsigned depth = readShort(ip);
+			unsigned slot = readShort(ip);
+			Value sum = increment(frame->env_->getAt(depth, slot), frame->chunk_->constants_[readShort(ip)]);
+			checkAssignment(static_cast<VarType>(readShort(ip)), sum);
+			frame->env_->reassignAt(depth, slot, sum);
+		}
+		NEXT();
+		HANDLER(ADD_GLOBAL_CONST_CHECKED):
+		{
+			unsigned slot = readShort(ip);
+			Value sum = increment(globals_->get(slot), frame->chunk_->constants_[readShort(ip)]);
+			checkAssignment(static_cast<VarType>(readShort(ip)), sum);
+			globals_->define(slot, sum);
+		}
+		NEXT();
+
+		HANDLER(CHECK_CALLABLE):
+			checkCallable(stack_.back());
+			NEXT();
+		HANDLER(CALL):
+		{
+			unsigned count = readShort(ip);
+			size_t base = stack_.size() - count - 1;
+			frame->ip_ = ip;
+			if (call(base, base + 1, count))
+			{
+				frame = &frames_.back();
+				ip = frame->ip_;
+			}
+		}
+		NEXT();
+		HANDLER(INVOKE):
+		{
+			unsigned count = readShort(ip);
+			size_t base = stack_.size() - count - 2;
+			frame->ip_ = ip;
+
+			bool entered = true;
+			if (stack_[base + 1].isNil())
+				entered = call(base, base + 2, count);
+			else
+			{
+				CustomFunction::pointer_type const& method = stack_[base].as<CustomFunction>();
+				checkArity(*method, count);
+				callFunction(method, stack_[base + 1], count, base + 2, base);
+			}
+
+			if (entered)
+			{
+				frame = &frames_.back();
+				ip = frame->ip_;
+			}
+		}
+		NEXT();
+		HANDLER(CLOSURE):
+		{
+			FunctionProto const& proto = *program_->functions_[readShort(ip)];
+			stack_.push_back(Value(Heap::get().make<CustomFunction>(proto.declaration_, frame->env_, false, false, &proto)));
+		}
+		NEXT();
+		HANDLER(INHERIT):
+		{
+			Value super = pop();
+			if (!super.isObject() || !is<BetaClass>(super.ref()))
+			{
+				stringstream ss;
+				ss << "InterpreterException: \"" << super.toString() << "\" is not a known class.";
+				throw Interpreter::InterpreterException(ss.str().c_str());
+			}
+
+			// super is just inside of the class's environment
+			frame->env_ = Heap::get().make<Environment>(frame->env_, 1);
+			frame->env_->define(0, super);
+		}
+		NEXT();
+		HANDLER(CLASS):
+		{
+			ClassProto const& proto = program_->classes_[readShort(ip)];
+			StmtClass const& decl = *proto.declaration_;
+
+			map<string, CustomFunction::pointer_type> methods;
+			auto itProto = proto.methods_.cbegin();
+			for (auto const& method : decl.methods_)
+			{
+				FunctionProto const& func = *program_->functions_[*itProto++];
+				methods.insert(pair<string, CustomFunction::pointer_type>(method->ident_->getName(), Heap::get().make<CustomFunction>(method.get(), frame->env_, true, method->ident_->getName() == "init", &func)));
+			}
+
+			BetaClass::pointer_type super;
+			if (decl.super_ != nullptr)
+			{
+				super = frame->env_->get(0).as<BetaClass>();
+				frame->env_ = frame->env_->parent_;
+			}
+
+			stack_.push_back(Value(Heap::get().make<BetaClass>(decl.name_->getName(), super, decl.data_, methods)));
+		}
+		NEXT();
+		HANDLER(RETURN):
+		HANDLER(LEAVE):
+		{
+			bool explicitReturn = static_cast<OpCode>(ip[-1]) == OpCode::RETURN;
+			Value result = returnValue(explicitReturn ? pop() : Value(), explicitReturn);
+
+			size_t base = frame->base_;
+			pool_.release(frame->poolMark_);
+			frames_.pop_back();
+			stack_.resize(base);
+			stack_.push_back(result);
+
+			frame = &frames_.back();
+			ip = frame->ip_;
+		}
+		NEXT();
+		HANDLER(PRINT):
+			cout << pop().toString() << endl;
+			NEXT();
+		HANDLER(NEXT_STATEMENT):
+			++PositionTracker::itStmtPos_;
+			NEXT();
+		HANDLER(HALT):
+			return;
+		}
+	}
+}
+
+/**
+@name:		call
+@purpose:	calls the value at base with the arguments that start at args, and returns true if a new frame was entered
+@param:		std::size_t, std::size_t, unsigned
+@return:	bool
+*/
+bool VM::call(std::size_t base, std::size_t args, unsigned count)
+{
+	checkCallable(stack_[base]);
+
+	BetaCallable::pointer_type func = stack_[base].as<BetaCallable>();
+	checkArity(*func, count);
+
+	if (is<CustomFunction>(func))
+	{
+		CustomFunction::pointer_type custom = static_pointer_cast<CustomFunction>(func);
+		callFunction(custom, custom->receiver_, count, args, base);
+		return true;
+	}
+
+	if (is<BetaClass>(func))
+	{
+		BetaClass::pointer_type cla = static_pointer_cast<BetaClass>(func);
+		BetaInstance::pointer_type instance = cla->instantiate();
+		CustomFunction::pointer_type init = cla->initializer();
+
+		// init returns the instance, so its frame leaves the result in place
+		if (init != nullptr)
+		{
+			callFunction(init, Value(instance), count, args, base);
+			return true;
+		}
+
+		stack_.resize(base);
+		stack_.push_back(Value(instance));
+		return false;
+	}
+
+	// native functions never look at the interpreter
+	Value result = func->call(nullptr, ArgSpan(stack_.data() + args, count));
+	stack_.resize(base);
+	stack_.push_back(result);
+	return false;
+}
+
+/**
+@name:		callFunction
+@purpose:	binds the receiver and arguments to a new environment and enters the function's frame
+@param:		CustomFunction::pointer_type const &, Value const &, unsigned, std::size_t, std::size_t
+@return:	void
+*/
+void VM::callFunction(CustomFunction::pointer_type const& func, Value const& receiver, unsigned count, std::size_t args, std::size_t base)
+{
+	FunctionProto const& proto = *func->proto_;
+	size_t mark = pool_.mark();
+	Environment::pointer_type env = proto.declaration_->captured_
+		? Heap::get().make<Environment>(func->closure_, proto.declaration_->numSlots_)
+		: pool_.acquire(func->closure_, proto.declaration_->numSlots_);
+	unsigned slot = 0;
+
+	if (func->isMethod_)
+		env->define(slot++, receiver);
+
+	auto itParams = proto.declaration_->params_.cbegin();
+	for (unsigned i = 0; i < count; ++i, ++itParams)
+	{
+		Value const& arg = stack_[args + i];
+		VarType type = static_cast<Variable *>(itParams->get())->getType();
+
+		if (!proto.declaration_->argsChecked_ && !Interpreter::checkType(type, arg))
+			throw Interpreter::InterpreterException(string("InterpreterException: Cannot assign \"" + arg.toString() + "\" to a " + Interpreter::VarTypeName(type)).c_str());
+
+		env->define(slot++, arg);
+	}
+
+	frames_.push_back(CallFrame{ func, &proto.chunk_, proto.chunk_.code_.data(), env, base, receiver, mark });
+}
+
+/**
+@name:		checkArity
+@purpose:	throws if a call passes the wrong number of arguments
+@param:		BetaCallable &, unsigned
+@return:	void
+*/
+void VM::checkArity(BetaCallable & func, unsigned count)
+{
+	if (count != func.arity())
+	{
+		stringstream ss;
+		ss << "Expected " << func.arity() << " arguments, but received " << count << ".";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+}
+
+/**
+@name:		returnValue
+@purpose:	returns what a function call evaluates to, an init method always gives back its instance
+@param:		Value, bool
+@return:	Value
+*/
+Value VM::returnValue(Value val, bool explicitReturn)
+{
+	CallFrame const& frame = frames_.back();
+	CustomFunction const& func = *frame.function_;
+
+	if (func.isInit_ && val.isNil())
+		return frame.receiver_;
+
+	// only a return statement is checked against the function's type, and only if the type checker could not prove it
+	VarType type = func.declaration_->ident_->getType();
+	if (explicitReturn && !func.declaration_->returnsChecked_ && !Interpreter::checkType(type, val))
+		throw Interpreter::InterpreterException(string("InterpreterException: Cannot return \"" + val.toString() + "\" when expected type is " + Interpreter::VarTypeName(type)).c_str());
+
+	return val;
+}
+
+/**
+@name:		checkCallable
+@purpose:	throws if a value cannot be called
+@param:		Value const &
+@return:	void
+*/
+void VM::checkCallable(Value const& callee)
+{
+	if (callee.isNil())
+	{
+		stringstream ss;
+		ss << "\"" << callee.toString() << "\" is not initialized!";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	if (!callee.isObject() || !is<BetaCallable>(callee.ref()))
+		throw Interpreter::InterpreterException("Can only call functions.");
+}
+
+/**
+@name:		instanceOf
+@purpose:	returns the instance whose property is being accessed, or throws if the value is not one
+@param:		Value const &, std::string const &
+@return:	BetaInstance::pointer_type
+*/
+BetaInstance::pointer_type VM::instanceOf(Value const& obj, std::string const& name)
+{
+	if (obj.isNil())
+	{
+		stringstream ss;
+		ss << "\"" << name << "\" is not initialized!";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	if (!obj.isObject() || !is<BetaInstance>(obj.ref()))
+	{
+		stringstream ss;
+		ss << "InterpreterException: " << "\"" << name << "\" is not an object.";
+		throw Interpreter::InterpreterException(ss.str().c_str());
+	}
+
+	return obj.as<BetaInstance>();
+}
+
+/**
+@name:		pop
+@purpose:	removes and returns the top of the stack
+@param:		null
+@return:	Value
+*/
+Value VM::pop()
+{
+	Value val = std::move(stack_.back());
+	stack_.pop_back();
+	return val;
+}
+
+/**
+@name:		binary
+@purpose:	replaces the top two values with the result of a binary operator
+@param:		null
+@return:	void
+*/
+template <typename Op>
+void VM::binary()
+{
+	static Op op;
+	Value second = pop();
+	stack_.back() = op.Op::perform(stack_.back(), second);
+}
+
+/**
+@name:		unary
+@purpose:	replaces the top value with the result of a unary operator
+@param:		null
+@return:	void
+*/
+template <typename Op>
+void VM::unary()
+{
+	static Op op;
+	stack_.back() = op.Op::perform(stack_.back());
+}
@@ -0,0 +1,56 @@
+/**	@file vm.hpp
+	@author Benjamin Godin
+	@date 2026-10-18
+	@version 1.0.0
+	@note Developed for C++17
+	@breif defines the structure of the stack-based virtual machine that runs compiled programs
+*/
+
+#pragma once
+#include "bytecode.hpp"
+#include "environment.hpp"
+#include "custom_func.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class VM
+{
+private:
+	struct CallFrame
+	{
+		CustomFunction::pointer_type function_;		// null for the top-level script
+		Chunk const * chunk_;
+		std::uint8_t const * ip_;
+		Environment::pointer_type env_;
+		std::size_t base_;							// stack index of the callee, where the result goes
+		Value receiver_;							// instance passed as "me" to a method
+		std::size_t poolMark_;						// pooled environments above this belong to the call
+	};
+
+	FramePool pool_;							// environments of the blocks and calls that nothing captures, outlives the frames below
+	Program const * program_;
+	Environment::pointer_type globals_;
+	std::vector<Value> stack_;
+	std::vector<CallFrame> frames_;
+
+public:
+	VM(Environment::pointer_type globals);
+	void run(Program const& program);
+
+private:
+	void execute();
+	bool call(std::size_t base, std::size_t args, unsigned count);
+	void callFunction(CustomFunction::pointer_type const& func, Value const& receiver, unsigned count, std::size_t args, std::size_t base);
+	void checkArity(BetaCallable & func, unsigned count);
+	Value returnValue(Value val, bool explicitReturn);
+
+	void checkCallable(Value const& callee);
+	Ref<BetaInstance> instanceOf(Value const& obj, std::string const& name);
+	Value pop();
+
+	template <typename Op>
+	void binary();
+	template <typename Op>
+	void unary();
+};
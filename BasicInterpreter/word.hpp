@@ -17,8 +17,9 @@ public:
 	using value_type = string_type;
 private:
 	value_type value_;
+	friend class Value;		// promoting a word nothing else shares moves its text instead of copying it
 public:
-	Word(value_type value = "") : value_(value) {}
-	value_type getValue() const { return value_; }
+	Word(value_type value = "") : value_(value) { kind_ = first_kind; }
+	value_type const& getValue() const { return value_; }
 	string_type toString() const { return value_; }
 };
\ No newline at end of file
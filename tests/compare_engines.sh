@@ -0,0 +1,27 @@
+#!/bin/sh
+# Runs every program in this folder on the four engines and fails if any engine prints something other
+# than the tree walker does, errors included.
+# usage: compare_engines.sh <path to the BasicInterpreter executable>
+
+bilby="$1"
+if [ -z "$bilby" ]; then
+	echo "usage: $0 <path to the BasicInterpreter executable>" >&2
+	exit 2
+fi
+
+status=0
+for program in "$(dirname "$0")"/*.bb; do
+	expected=$("$bilby" "$program" tree 2>&1)
+	for engine in bytecode closure register; do
+		actual=$("$bilby" "$program" $engine 2>&1)
+		if [ "$actual" != "$expected" ]; then
+			echo "FAIL $program on $engine" >&2
+			echo "  tree:    $expected" >&2
+			echo "  $engine: $actual" >&2
+			status=1
+		fi
+	done
+done
+
+[ $status -eq 0 ] && echo "every engine agrees"
+exit $status